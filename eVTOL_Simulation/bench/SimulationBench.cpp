@@ -0,0 +1,529 @@
+/**
+ * @file SimulationBench.cpp
+ * @brief Google Benchmark suite for the simulation hot paths
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "main.h"
+#include "Battery.h"
+#include "ChargeCurve.h"
+#include "ChargeQueue.h"
+#include "DepotNetwork.h"
+#include "FaultScheduler.h"
+#include "FleetState.h"
+#include "Philox.h"
+#include "ProductionFleet.h"
+#include "SimClock.h"
+#include "ThreadPool.h"
+#include "Simulation.h"
+#include "TelemetrySink.h"
+#include "VehicleFactory.h"
+#include "VehicleRegistry.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// Fixed seed so every run of the suite works on the same fleet
+constexpr uint64_t BENCH_SEED = 2022;
+
+// Fleet sizes for the per-tick kernels and for the full simulated hour
+static const std::vector<int64_t> KERNEL_FLEET_SIZES = {20, 1000, 100000, 10000000};
+static const std::vector<int64_t> HOUR_FLEET_SIZES = {20, 1000, 10000};
+static const std::vector<int64_t> CHARGER_COUNTS = {3, 30};
+
+// Kernel steps between restores of the fleet's starting charges. A full
+// battery takes thousands of steps to drain or fill, so the fleet stays
+// close to its mixed starting state instead of ending up all empty or full.
+constexpr size_t CHARGE_RESTORE_STEPS = 64;
+
+// Helper function prototypes
+static const VehicleRegistry &getRegistry();
+static FleetState makeFleetState(size_t count, bool grouped = false);
+static void setMixedCharges(FleetState &fleet);
+static std::vector<double> getCharges(const FleetState &fleet);
+static void restoreCharges(benchmark::State &state, FleetState &fleet, const std::vector<double> &charges, size_t &steps);
+
+/**
+ * @brief Per tick drain of every flying battery, the work of
+ * manageVehiclesFlying
+ * 
+ */
+static void BM_DrainFlying(benchmark::State &state) {
+    auto fleet = makeFleetState(state.range(0));
+    auto charges = getCharges(fleet);
+    size_t steps = 0;
+    std::vector<size_t> depleted;
+    for(auto _ : state) {
+        depleted.clear();
+        fleet.drainFlying(SIM_STEP_MS, depleted);
+        benchmark::DoNotOptimize(depleted.data());
+        restoreCharges(state, fleet, charges, steps);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DrainFlying)->ArgNames({"fleet"})->ArgsProduct({KERNEL_FLEET_SIZES});
+
+/**
+ * @brief Per tick charge of every vehicle on a charger, the work of
+ * manageChargers
+ * 
+ */
+static void BM_ChargeCharging(benchmark::State &state) {
+    size_t count = state.range(0);
+    auto fleet = makeFleetState(count);
+    for(size_t i = 0; i < std::min<size_t>(state.range(1), count); i++) {
+        fleet.setStatus(i, VehicleStatus::CHARGING);
+    }
+    auto charges = getCharges(fleet);
+    size_t steps = 0;
+    std::vector<size_t> full;
+    for(auto _ : state) {
+        full.clear();
+        fleet.chargeCharging(SIM_STEP_MS, full);
+        benchmark::DoNotOptimize(full.data());
+        restoreCharges(state, fleet, charges, steps);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ChargeCharging)->ArgNames({"fleet", "chargers"})->ArgsProduct({KERNEL_FLEET_SIZES, CHARGER_COUNTS});
+
+/**
+ * @brief BM_ChargeCharging walking the charging list instead of scanning
+ * the fleet, with the vehicles on a charger spread over the fleet
+ * 
+ */
+static void BM_ChargeGroup(benchmark::State &state) {
+    size_t count = state.range(0);
+    auto fleet = makeFleetState(count);
+    size_t charging = std::min<size_t>(state.range(1), count);
+    for(size_t i = 0; i < charging; i++) {
+        fleet.setStatus(i * count / charging, VehicleStatus::CHARGING);
+    }
+    auto charges = getCharges(fleet);
+    size_t steps = 0;
+    std::vector<size_t> full;
+    for(auto _ : state) {
+        full.clear();
+        fleet.chargeGroup(SIM_STEP_MS, 0, full);
+        benchmark::DoNotOptimize(full.data());
+        restoreCharges(state, fleet, charges, steps);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ChargeGroup)->ArgNames({"fleet", "chargers"})->ArgsProduct({KERNEL_FLEET_SIZES, CHARGER_COUNTS});
+
+/**
+ * @brief BM_DrainFlying with the rates of the production vehicle types
+ * compiled in, on a mixed fleet and on one grouped by type
+ * 
+ */
+static void BM_DrainFlyingFixed(benchmark::State &state) {
+    size_t count = state.range(0);
+    auto fleet = makeFleetState(count, state.range(1));
+    auto charges = getCharges(fleet);
+    size_t steps = 0;
+    ProductionKernels kernels;
+    std::vector<size_t> depleted;
+    for(auto _ : state) {
+        depleted.clear();
+        kernels.drainFlying(fleet, SIM_STEP_MS, 0, count, depleted);
+        benchmark::DoNotOptimize(depleted.data());
+        restoreCharges(state, fleet, charges, steps);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DrainFlyingFixed)->ArgNames({"fleet", "grouped"})->ArgsProduct({KERNEL_FLEET_SIZES, {0, 1}});
+
+/**
+ * @brief BM_ChargeCharging with the rates of the production vehicle types
+ * compiled in, on a mixed fleet and on one grouped by type
+ * 
+ */
+static void BM_ChargeChargingFixed(benchmark::State &state) {
+    size_t count = state.range(0);
+    auto fleet = makeFleetState(count, state.range(2));
+    for(size_t i = 0; i < std::min<size_t>(state.range(1), count); i++) {
+        fleet.setStatus(i, VehicleStatus::CHARGING);
+    }
+    auto charges = getCharges(fleet);
+    size_t steps = 0;
+    ProductionKernels kernels;
+    std::vector<size_t> full;
+    for(auto _ : state) {
+        full.clear();
+        kernels.chargeCharging(fleet, SIM_STEP_MS, 0, count, full);
+        benchmark::DoNotOptimize(full.data());
+        restoreCharges(state, fleet, charges, steps);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ChargeChargingFixed)->ArgNames({"fleet", "chargers", "grouped"})->ArgsProduct({KERNEL_FLEET_SIZES, CHARGER_COUNTS, {0, 1}});
+
+/**
+ * @brief BM_DrainFlyingFixed on a fleet from the factory, copied in fleet
+ * order or grouped by type as the polling loop copies it. fixedShare is the
+ * share of the fleet the compiled kernels step; the rest falls back to the
+ * runtime kernels.
+ * 
+ */
+static void BM_DrainFlyingFixedFactory(benchmark::State &state) {
+    size_t count = state.range(0);
+    VehicleFactory factory(getRegistry());
+    auto vehicles = factory.createFleet({}, count, BENCH_SEED);
+    FleetState fleet;
+    if(state.range(1)) {
+        fleet.addFleet(vehicles, [](size_t) { return 0; });
+    } else {
+        fleet.reserve(count);
+        for(const auto &vehicle : vehicles) {
+            fleet.addVehicle(*vehicle);
+        }
+    }
+    setMixedCharges(fleet);
+    auto charges = getCharges(fleet);
+    size_t steps = 0;
+    size_t fixed = 0;
+    for(const auto &run : fleet.getTypeRuns()) {
+        if(run.end - run.begin >= MIN_TYPE_RUN_LENGTH) fixed += run.end - run.begin;
+    }
+
+    ProductionKernels kernels;
+    std::vector<size_t> depleted;
+    for(auto _ : state) {
+        depleted.clear();
+        kernels.drainFlying(fleet, SIM_STEP_MS, 0, count, depleted);
+        benchmark::DoNotOptimize(depleted.data());
+        restoreCharges(state, fleet, charges, steps);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["fixedShare"] = (double)fixed / count;
+}
+BENCHMARK(BM_DrainFlyingFixedFactory)->ArgNames({"fleet", "grouped"})->ArgsProduct({KERNEL_FLEET_SIZES, {0, 1}});
+
+/**
+ * @brief Per tick waiting time added to every queued vehicle, with every
+ * vehicle not on a charger in the queue
+ * 
+ */
+static void BM_IncreaseTimeWaiting(benchmark::State &state) {
+    size_t count = state.range(0);
+    auto fleet = makeFleetState(count);
+    ChargeQueue queue;
+    for(size_t i = std::min<size_t>(state.range(1), count); i < count; i++) {
+        fleet.setStatus(i, VehicleStatus::QUEUED);
+        queue.enqueueVehicleWaiting(i);
+    }
+    for(auto _ : state) {
+        queue.increaseTimeWaiting(fleet, SIM_STEP_MS);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * queue.size());
+}
+BENCHMARK(BM_IncreaseTimeWaiting)->ArgNames({"fleet", "chargers"})->ArgsProduct({KERNEL_FLEET_SIZES, CHARGER_COUNTS});
+
+/**
+ * @brief One charge cycle through the charger pool with the rest of the
+ * fleet queued: release a charger, admit the next vehicle, requeue the
+ * vehicle released
+ * 
+ */
+static void BM_ChargerAdmission(benchmark::State &state) {
+    size_t count = state.range(0);
+    const auto &registry = getRegistry();
+    ChargerPool chargers(std::min<size_t>(state.range(1), count), QueuePolicy::SHORTEST_CHARGE_FIRST);
+    for(size_t i = 0; i < count; i++) {
+        chargers.enqueueVehicleWaiting(i, registry[i % registry.size()]);
+    }
+    size_t charger;
+    while(chargers.canAdmit()) {
+        chargers.admitNext(charger);
+    }
+
+    size_t next = 0;
+    for(auto _ : state) {
+        size_t released = chargers[next].getVehicleCharging();
+        chargers.release(next);
+        if(chargers.canAdmit()) chargers.admitNext(next);
+        chargers.enqueueVehicleWaiting(released, registry[released % registry.size()]);
+        benchmark::DoNotOptimize(next);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ChargerAdmission)->ArgNames({"fleet", "chargers"})->ArgsProduct({KERNEL_FLEET_SIZES, CHARGER_COUNTS});
+
+/**
+ * @brief Hand-off of a tick's depleted vehicles to a depot through its
+ * lock-free arrivals queue, collected in vehicle order or hand-off order
+ * 
+ */
+static void BM_DepotArrivals(benchmark::State &state) {
+    size_t count = state.range(0);
+    Depot depot(NUM_OF_CHARGERS, QueuePolicy::FIFO, state.range(1));
+    depot.reset(count);
+    for(auto _ : state) {
+        // Arrive in reverse so ordering has work to do
+        for(size_t i = count; i > 0; i--) {
+            depot.arrive(i - 1);
+        }
+        benchmark::DoNotOptimize(depot.collectArrivals().data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DepotArrivals)->ArgNames({"fleet", "ordered"})->ArgsProduct({{20, 1000, 100000}, {0, 1}});
+
+/**
+ * @brief Status change of one vehicle, an O(1) relink between the intrusive
+ * flying, queued and charging lists
+ * 
+ */
+static void BM_StatusRelink(benchmark::State &state) {
+    size_t count = state.range(0);
+    auto fleet = makeFleetState(count);
+    const VehicleStatus cycle[] = {VehicleStatus::QUEUED, VehicleStatus::CHARGING, VehicleStatus::FLYING};
+    size_t i = 0;
+    for(auto _ : state) {
+        size_t vehicle = (i * 7919) % count;
+        fleet.setStatus(vehicle, cycle[(size_t)fleet.getStatus(vehicle)]);
+        i++;
+    }
+    benchmark::DoNotOptimize(fleet.getStatusCount(VehicleStatus::FLYING));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StatusRelink)->ArgNames({"fleet"})->ArgsProduct({KERNEL_FLEET_SIZES});
+
+/**
+ * @brief Per tick fault check of the fleet, which replaced the per vehicle
+ * Vehicle::faultCheck
+ * 
+ */
+static void BM_FaultCheck(benchmark::State &state) {
+    size_t count = state.range(0);
+    Philox rng(BENCH_SEED);
+    FaultScheduler faults(rng);
+    const auto &registry = getRegistry();
+    for(size_t i = 0; i < count; i++) {
+        faults.addVehicle(i, registry[i % registry.size()].faultRate);
+    }
+    faults.start(0.0);
+
+    std::vector<size_t> faulted;
+    double nowMs = 0.0;
+    for(auto _ : state) {
+        faulted.clear();
+        nowMs += SIM_STEP_MS;
+        faults.collectDue(nowMs, faulted);
+        benchmark::DoNotOptimize(faulted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_FaultCheck)->ArgNames({"fleet"})->ArgsProduct({KERNEL_FLEET_SIZES});
+
+/**
+ * @brief State change of every battery through the Battery object: settle
+ * the charge, switch between draining and charging and work out when the
+ * next change is due
+ * 
+ */
+static void BM_BatteryStateChange(benchmark::State &state) {
+    size_t count = state.range(0);
+    const auto &registry = getRegistry();
+    std::vector<Battery> batteries;
+    batteries.reserve(count);
+    for(size_t i = 0; i < count; i++) {
+        const auto &spec = registry[i % registry.size()];
+        batteries.emplace_back(spec.batteryCapacityKwh, spec.energyUseKwh, spec.timeToChargeHr);
+    }
+    double nowMs = 0.0;
+    double dueMs = 0.0;
+    for(auto _ : state) {
+        nowMs += SIM_STEP_MS;
+        for(auto &battery : batteries) {
+            if(battery.getMode() == BatteryMode::DRAINING) {
+                battery.setMode(BatteryMode::CHARGING, nowMs);
+                dueMs += battery.getTimeToFull(nowMs);
+            } else {
+                battery.setMode(BatteryMode::DRAINING, nowMs);
+                dueMs += battery.getTimeToEmpty(nowMs);
+            }
+        }
+        benchmark::DoNotOptimize(dueMs);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_BatteryStateChange)->ArgNames({"fleet"})->ArgsProduct({KERNEL_FLEET_SIZES});
+
+/**
+ * @brief Charge after a time on a tapering charge curve and the time to
+ * reach a charge, one lookup each
+ * 
+ */
+static void BM_ChargeCurveLookup(benchmark::State &state) {
+    auto curve = ChargeCurve::createCcCv(320.0, 320.0 / HR_TO_MS(0.6), 0.8);
+    double ms = 0.0;
+    double step = curve->getFullMs() / 997.0;
+    double total = 0.0;
+    for(auto _ : state) {
+        ms = (ms + step < curve->getFullMs()) ? ms + step : 0.0;
+        total += curve->getMsAt(curve->getChargeAt(ms));
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ChargeCurveLookup);
+
+/**
+ * @brief Cost to the simulation thread of recording a telemetry sample,
+ * with the writer thread streaming binary chunks or CSV to /dev/null
+ * 
+ */
+static void BM_TelemetryRecord(benchmark::State &state) {
+    TelemetrySink sink;
+    sink.open("/dev/null", state.range(0) ? TelemetryFormat::CSV : TelemetryFormat::BINARY);
+    TelemetrySample sample;
+    sample.flying = 1000;
+    sample.soc.fill(100);
+    for(auto _ : state) {
+        sample.timeMs += SIM_STEP_MS;
+        sink.record(sample);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TelemetryRecord)->ArgNames({"csv"})->Arg(0)->Arg(1);
+
+/**
+ * @brief Fleet setup through the factory, built in arena chunks on a pool
+ * of threads
+ * 
+ */
+static void BM_CreateFleet(benchmark::State &state) {
+    VehicleFactory factory(getRegistry());
+    std::unique_ptr<ThreadPool> pool;
+    if(state.range(1) > 1) pool = std::make_unique<ThreadPool>(state.range(1));
+    for(auto _ : state) {
+        auto vehicles = factory.createFleet({}, state.range(0), BENCH_SEED, FLEET_STREAM, pool.get());
+        benchmark::DoNotOptimize(vehicles.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CreateFleet)->ArgNames({"fleet", "threads"})->ArgsProduct({{20, 1000, 100000, 1000000}, {1, 4}})->UseRealTime();
+
+/**
+ * @brief One complete simulated hour, polling loop or event engine
+ * 
+ */
+template <bool EventDriven>
+static void BM_SimulatedHour(benchmark::State &state) {
+    const auto &registry = getRegistry();
+    VehicleFactory factory(registry);
+    FastClock clock;
+    for(auto _ : state) {
+        state.PauseTiming();
+        auto vehicles = factory.createFleet({}, state.range(0), BENCH_SEED);
+        DepotNetwork depots(1, state.range(1));
+        Simulation sim(clock, registry, BENCH_SEED);
+        sim.setShowProgress(false);
+        state.ResumeTiming();
+
+        if(EventDriven) {
+            sim.startEventSimulation(vehicles, depots, HR_TO_MS(1));
+        } else {
+            sim.startSimulation(vehicles, depots, HR_TO_MS(1));
+        }
+        benchmark::DoNotOptimize(sim.getStats().getVehicleCount());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_SimulatedHour, false)->Name("BM_SimulatedHourPolling")
+    ->ArgNames({"fleet", "chargers"})->ArgsProduct({HOUR_FLEET_SIZES, CHARGER_COUNTS})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SimulatedHour, true)->Name("BM_SimulatedHourEvent")
+    ->ArgNames({"fleet", "chargers"})->ArgsProduct({HOUR_FLEET_SIZES, CHARGER_COUNTS})->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief One simulated hour of the polling loop with the fleet stepped in
+ * chunks across a pool of threads, to measure scaling against one thread
+ * 
+ */
+static void BM_SimulatedHourParallel(benchmark::State &state) {
+    const auto &registry = getRegistry();
+    VehicleFactory factory(registry);
+    FastClock clock;
+    ThreadPool pool(state.range(1));
+    for(auto _ : state) {
+        state.PauseTiming();
+        auto vehicles = factory.createFleet({}, state.range(0), BENCH_SEED);
+        DepotNetwork depots(state.range(1), state.range(0) / 100);
+        Simulation sim(clock, registry, BENCH_SEED);
+        sim.setShowProgress(false);
+        sim.setStepPool(&pool);
+        state.ResumeTiming();
+
+        sim.startSimulation(vehicles, depots, HR_TO_MS(1));
+        benchmark::DoNotOptimize(sim.getStats().getVehicleCount());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SimulatedHourParallel)->ArgNames({"fleet", "threads"})
+    ->ArgsProduct({{100000, 1000000}, {1, 2, 4, 8, 16, 32}})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
+
+/*******************Private Helper Functions***********************/
+static const VehicleRegistry &getRegistry() {
+    static VehicleRegistry registry = [] {
+        VehicleRegistry loaded;
+        if(!loaded.loadCsv(VEHICLE_CONFIG_FILE)) std::exit(1);
+        return loaded;
+    }();
+    return registry;
+}
+
+static FleetState makeFleetState(size_t count, bool grouped) {
+
+    // One vehicle per type is enough, FleetState only copies its values
+    const auto &registry = getRegistry();
+    std::vector<Vehicle> types;
+    for(size_t i = 0; i < registry.size(); i++) {
+        types.emplace_back(registry[i]);
+    }
+
+    FleetState fleet;
+    fleet.reserve(count);
+    for(size_t i = 0; i < count; i++) {
+        fleet.addVehicle(types[grouped ? i * types.size() / count : i % types.size()]);
+    }
+    setMixedCharges(fleet);
+    return fleet;
+}
+
+static void setMixedCharges(FleetState &fleet) {
+
+    // Spread the charges over the whole battery, so every step drains or
+    // charges like a fleet part way through a run
+    for(size_t i = 0; i < fleet.size(); i++) {
+        fleet.setCharge(i, fleet.getCapacity(i) * ((i * 7919) % 1000 + 0.5) / 1000.0);
+    }
+}
+
+static std::vector<double> getCharges(const FleetState &fleet) {
+    std::vector<double> charges(fleet.size());
+    for(size_t i = 0; i < fleet.size(); i++) {
+        charges[i] = fleet.getCharge(i);
+    }
+    return charges;
+}
+
+static void restoreCharges(benchmark::State &state, FleetState &fleet, const std::vector<double> &charges, size_t &steps) {
+    if(++steps < CHARGE_RESTORE_STEPS) return;
+    steps = 0;
+    state.PauseTiming();
+    for(size_t i = 0; i < fleet.size(); i++) {
+        fleet.setCharge(i, charges[i]);
+    }
+    state.ResumeTiming();
+}
@@ -0,0 +1,56 @@
+/**
+ * @file BatchRunner.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include "ProductionFleet.h"
+#include "SampleStats.h"
+#include "SimulationConfig.h"
+#include "SimulationStats.h"
+#include "VehicleRegistry.h"
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Distribution of one vehicle type's results over the replicas. Times,
+// faults and distance are per vehicle, so replicas with different fleet
+// mixes can be compared.
+struct TypeSummary {
+    std::string name;
+    SampleStats vehicleCount;
+    SampleStats timeInFlightHr;
+    SampleStats timeChargingHr;
+    SampleStats timeAwaitingChargeHr;
+    SampleStats faultCount;
+    SampleStats distanceAllPassengersMi;
+};
+
+// Runs many independent replicas of the simulation across all cores. Each
+// replica gets its own random fleet, random stream, clock and stats, so the
+// replicas share nothing but the read-only vehicle registry.
+class BatchRunner {
+    private:
+        const VehicleRegistry &_registry;
+        SimulationConfig _config;
+        ProductionKernels _fixedKernels;
+        size_t _replicas = 0;
+        uint64_t _seed = 0;
+        std::vector<TypeSummary> _summary;
+        std::vector<TypeStats> runReplica(size_t replica) const;
+    public:
+        BatchRunner(const VehicleRegistry &registry, const SimulationConfig &config);
+        void run(size_t replicas, uint64_t seed);
+        const std::vector<TypeSummary> &getSummary() const;
+        void printSummary() const;
+        void printSummaryCsv() const;
+};
+
+#endif /* BATCH_RUNNER_H */
@@ -1,35 +1,60 @@
-/**
- * @file Battery.h
- * @author Adrian Deardorff (80deardorff@gmail.com)
- * @version 0.1
- * @date 2022-05-11
- * 
- * @copyright Copyright (c) 2022
- * 
- */
-#ifndef BATTERY_H
-#define BATTERY_H
-
-class Battery {
-    private:
-        int _capacityKwh;
-        double _currChargeKwh;
-        double _energyUseKwh;
-        double _stateOfCharge = 100.0;
-        double _timeToChargeHr;
-        bool _charging = false;
-
-        void setStateOfCharge();
-    public:
-        Battery(int capacityKwh, double energyUse, double timeToChargeHr);
-        int getCapacity() const;
-        double getStateOfCharge() const;
-        double getEnergyUse() const;
-        double getTimeToChargeHr() const;
-        void drainBattery(long ms);
-        void chargeBattery();
-        bool isCharging() const;
-        void setCharging(int EnOrDi);
-};
-
-#endif /* BATTERY_H */
+/**
+ * @file Battery.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2022-05-11
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+#ifndef BATTERY_H
+#define BATTERY_H
+
+#include "ChargeCurve.h"
+
+enum class BatteryMode {
+    IDLE,
+    DRAINING,
+    CHARGING
+};
+
+// Raw state of a battery, for checkpoints
+struct BatteryState {
+    double chargeKwh;                   // Charge at the last mode change
+    double sinceMs;
+    BatteryMode mode;
+};
+
+// Drain and charge are linear in time, so the battery only stores its charge
+// at the last mode change and works out the charge at any later time from
+// the rate of its mode, or its place on the charge curve when the charger
+// tapers. Nothing needs updating between mode changes.
+class Battery {
+    private:
+        int _capacityKwh;
+        double _energyUseKwh;
+        double _timeToChargeHr;
+        double _chargeRateKwh;
+        const ChargeCurve *_curve;      // Null when charging linearly
+        double _chargeKwh;              // Charge at _sinceMs
+        double _sinceMs = 0.0;
+        double _curveMs = 0.0;          // Time on the curve at _sinceMs
+        BatteryMode _mode = BatteryMode::IDLE;
+    public:
+        Battery(int capacityKwh, double energyUse, double timeToChargeHr, const ChargeCurve *curve = nullptr);
+        int getCapacity() const;
+        double getCharge(double nowMs) const;
+        double getStateOfCharge(double nowMs) const;
+        double getEnergyUse() const;
+        double getTimeToChargeHr() const;
+        double getChargeRate() const;
+        double getTimeToEmpty(double nowMs) const;
+        double getTimeToFull(double nowMs) const;
+        BatteryMode getMode() const;
+        void setMode(BatteryMode mode, double nowMs);
+        BatteryState getState() const;
+        void setState(const BatteryState &state);
+        bool isCharging() const;
+};
+
+#endif /* BATTERY_H */
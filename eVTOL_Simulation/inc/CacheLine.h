@@ -0,0 +1,19 @@
+/**
+ * @file CacheLine.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef CACHE_LINE_H
+#define CACHE_LINE_H
+
+#include <cstddef>
+
+// Size of a cache line. State written by different threads is aligned to
+// this so two threads never write to the same line.
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+#endif /* CACHE_LINE_H */
@@ -0,0 +1,44 @@
+/**
+ * @file ChargeCurve.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef CHARGE_CURVE_H
+#define CHARGE_CURVE_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Intervals in each lookup table of a charge curve
+constexpr size_t CHARGE_CURVE_POINTS = 1024;
+
+// Share of the rated charge rate left at 100% state of charge on a CC-CV
+// curve; the rate falls linearly to it from the taper point
+constexpr double CC_CV_END_RATE = 0.2;
+
+// State of charge of a battery against time on the charger, for chargers
+// whose rate depends on the state of charge. The curve is integrated once
+// into two tables, time against charge and charge against time, both evenly
+// spaced, so the charge after any time and the time to reach any charge are
+// an O(1) interpolation. Time on the curve is measured from empty.
+class ChargeCurve {
+    private:
+        double _capacityKwh;
+        double _fullMs;
+        std::vector<double> _msAtCharge;    // Evenly spaced in charge
+        std::vector<double> _chargeAtMs;    // Evenly spaced in time
+    public:
+        ChargeCurve(double capacityKwh, double ratedKwhPerMs, const std::function<double(double)> &relativeRate);
+        static std::shared_ptr<const ChargeCurve> createCcCv(double capacityKwh, double ratedKwhPerMs, double taperSoc);
+        double getFullMs() const;
+        double getMsAt(double chargeKwh) const;
+        double getChargeAt(double ms) const;
+};
+
+#endif /* CHARGE_CURVE_H */
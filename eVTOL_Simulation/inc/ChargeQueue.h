@@ -0,0 +1,48 @@
+/**
+ * @file ChargeQueue.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef CHARGE_QUEUE_H
+#define CHARGE_QUEUE_H
+
+#include <cstddef>
+#include <vector>
+#include "FleetState.h"
+
+// Line of vehicles waiting for a free charger, owned by one simulation. The
+// line is a binary heap: the lowest priority value is served first and equal
+// priorities are served in arrival order, so a constant priority is FIFO.
+class ChargeQueue {
+    public:
+        struct Entry {
+            double priority;
+            unsigned long sequence;
+            size_t vehicle;
+        };
+    private:
+
+        // Orders the entry to serve next to the top of the heap
+        struct Later {
+            bool operator()(const Entry &a, const Entry &b) const;
+        };
+
+        std::vector<Entry> _heap;
+        unsigned long _nextSequence = 0;
+    public:
+        void clear();
+        void enqueueVehicleWaiting(size_t vehicle, double priority = 0.0);
+        size_t dequeueVehicleWaiting();
+        bool isEmpty() const;
+        size_t size() const;
+        void increaseTimeWaiting(FleetState &fleet, double ms) const;
+        const std::vector<Entry> &getEntries() const;
+        unsigned long getNextSequence() const;
+        void restore(const std::vector<Entry> &entries, unsigned long nextSequence);
+};
+
+#endif /* CHARGE_QUEUE_H */
@@ -0,0 +1,55 @@
+/**
+ * @file ChargerPool.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef CHARGER_POOL_H
+#define CHARGER_POOL_H
+
+#include "ChargeQueue.h"
+#include "Charger.h"
+#include "VehicleSpec.h"
+#include <cstddef>
+#include <vector>
+
+// Order vehicles in the charge queue are served in
+enum class QueuePolicy {
+    FIFO,
+    SHORTEST_CHARGE_FIRST,
+    HIGHEST_PASSENGER_VALUE_FIRST
+};
+
+// Every charger plus the line waiting for them. Idle chargers sit on a free
+// list, so finding one is O(1) and admitting the next vehicle is O(log n) in
+// the queue length, instead of scanning every charger each tick.
+class ChargerPool {
+    private:
+        std::vector<Charger> _chargers;
+        std::vector<size_t> _idle;
+        std::vector<size_t> _chargerOf;
+        ChargeQueue _queue;
+        QueuePolicy _policy;
+        double getPriority(const VehicleSpec &spec) const;
+    public:
+        explicit ChargerPool(size_t count, QueuePolicy policy = QueuePolicy::FIFO);
+        void reset();
+        size_t size() const;
+        size_t getIdleCount() const;
+        QueuePolicy getPolicy() const;
+        const Charger &operator[](size_t charger) const;
+        const ChargeQueue &getQueue() const;
+        void enqueueVehicleWaiting(size_t vehicle, const VehicleSpec &spec);
+        bool canAdmit() const;
+        size_t admitNext(size_t &charger);
+        size_t getChargerOf(size_t vehicle) const;
+        void release(size_t charger);
+        void increaseTimeWaiting(FleetState &fleet, double ms) const;
+        const std::vector<size_t> &getIdle() const;
+        void restore(const std::vector<size_t> &charging, const std::vector<size_t> &idle, const std::vector<ChargeQueue::Entry> &queued, unsigned long nextSequence);
+};
+
+#endif /* CHARGER_POOL_H */
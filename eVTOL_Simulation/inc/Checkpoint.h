@@ -0,0 +1,121 @@
+/**
+ * @file Checkpoint.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Version of the checkpoint layout; files of any other version are refused
+constexpr uint32_t CHECKPOINT_VERSION = 2;
+
+// Sections start on this boundary in the file
+constexpr size_t CHECKPOINT_ALIGNMENT = 64;
+
+// Full state of an event-driven run between two events: the fleet, the
+// chargers and charge queue of every depot, the pending events, the fault
+// random number generator and the stats so far. A run restored from it
+// carries on exactly as the original run did. Each vehicle type also keeps
+// a fingerprint of its spec, so a restore with other specs is refused.
+//
+// Every section is a flat array of fixed-size records of 64 bit fields in
+// the machine's byte order (little endian on x86), so the file can be
+// memory mapped and read in place:
+//   header     "EVTLCKP1", uint32 version, uint32 section count
+//   directory  per section a uint32 id, uint32 record size, uint64 offset
+//              and uint64 record count
+//   sections   in id order, each at a multiple of CHECKPOINT_ALIGNMENT
+// Per depot lists (chargers, idle chargers, queue) are stored one depot
+// after another, located by the depot records.
+struct Checkpoint {
+    struct Run {
+        double nowMs;                   // Every earlier event is processed
+        double nextSampleMs;            // Next telemetry sample
+        uint64_t nextEventSequence;
+        uint64_t rngSeed;
+        uint64_t rngStream;
+        uint64_t rngCounter;
+        uint64_t rngBuffer[4];
+        uint64_t rngBuffered;
+    };
+
+    struct TypeEntry {
+        double timeInFlightHr;
+        double timeChargingHr;
+        double timeAwaitingChargeHr;
+        double distanceAllPassengersMi;
+        uint64_t faultCount;
+        uint64_t nameHash;              // FNV-1a of the type's name
+        double cruiseSpeedMph;
+        double batteryCapacityKwh;
+        double timeToChargeHr;
+        double energyUsePerMiKwh;
+        double passengerCount;
+        double faultProbability;
+        double chargeTaperSoc;
+    };
+
+    struct VehicleEntry {
+        uint64_t type;
+        uint64_t depot;
+        uint64_t state;                 // Flying, waiting or charging
+        double sinceMs;                 // Time the state was entered
+        double chargeKwh;               // Battery at its last mode change
+        double batterySinceMs;
+        uint64_t batteryMode;
+        double timeInFlightHr;
+        double timeChargingHr;
+        double timeAwaitingChargeHr;
+        double distanceAllPassengersMi;
+        uint64_t faultCount;
+    };
+
+    struct EventEntry {
+        double timeMs;
+        uint64_t sequence;
+        uint64_t type;
+        uint64_t vehicle;
+        uint64_t charger;
+        uint64_t depot;
+    };
+
+    struct DepotEntry {
+        uint64_t firstCharger;          // Into chargers
+        uint64_t chargerCount;
+        uint64_t firstIdle;             // Into idle
+        uint64_t idleCount;
+        uint64_t firstQueued;           // Into queued
+        uint64_t queuedCount;
+        uint64_t nextQueueSequence;
+        uint64_t policy;                // Queue policy of the depot
+    };
+
+    struct QueueEntry {
+        double priority;
+        uint64_t sequence;
+        uint64_t vehicle;
+    };
+
+    Run run{};
+    std::vector<TypeEntry> types;
+    std::vector<VehicleEntry> vehicles;
+    std::vector<EventEntry> events;
+    std::vector<DepotEntry> depots;
+    std::vector<uint64_t> chargers;     // Vehicle on each charger
+    std::vector<uint64_t> idle;         // Idle charger stacks
+    std::vector<QueueEntry> queued;     // Charge queue heaps
+
+    bool write(const std::string &path) const;
+    bool read(const std::string &path);
+};
+
+#endif /* CHECKPOINT_H */
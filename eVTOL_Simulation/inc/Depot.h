@@ -0,0 +1,42 @@
+/**
+ * @file Depot.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef DEPOT_H
+#define DEPOT_H
+
+#include "CacheLine.h"
+#include "ChargerPool.h"
+#include "MpmcQueue.h"
+#include <cstddef>
+#include <vector>
+
+// A charging depot with its own chargers and charge queue. Nothing in a
+// depot is shared with another depot, and each starts on its own cache
+// line, so depots can be stepped on separate threads without locks.
+// Vehicles that run out of charge are handed to the depot through a
+// lock-free arrivals queue, so any number of threads stepping the fleet can
+// send vehicles to the same depot at once.
+class alignas(CACHE_LINE_SIZE) Depot {
+    private:
+        ChargerPool _chargers;
+        std::vector<size_t> _full;
+        MpmcQueue<size_t> _arrivals;
+        std::vector<size_t> _arrived;
+        bool _orderedArrivals;
+    public:
+        Depot(size_t chargers, QueuePolicy policy, bool orderedArrivals = true);
+        void reset(size_t vehicles, bool arrivals = true);
+        bool arrive(size_t vehicle);
+        const std::vector<size_t> &collectArrivals();
+        ChargerPool &getChargers();
+        const ChargerPool &getChargers() const;
+        std::vector<size_t> &getFull();
+};
+
+#endif /* DEPOT_H */
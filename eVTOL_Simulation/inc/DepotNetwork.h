@@ -0,0 +1,35 @@
+/**
+ * @file DepotNetwork.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef DEPOT_NETWORK_H
+#define DEPOT_NETWORK_H
+
+#include "Depot.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// The charging depots of a region and the depot each vehicle charges at.
+// The depots are laid out once at construction and never move. Vehicles
+// are routed round robin, which every depot's arrivals queue is sized for.
+class DepotNetwork {
+    private:
+        std::vector<std::unique_ptr<Depot>> _depots;
+        std::vector<size_t> _depotOf;
+    public:
+        DepotNetwork(size_t depots, size_t chargersPerDepot, QueuePolicy policy = QueuePolicy::FIFO, bool orderedArrivals = true);
+        void reset(size_t vehicles, bool arrivals = true);
+        size_t size() const;
+        size_t getChargerCount() const;
+        Depot &operator[](size_t depot);
+        const Depot &operator[](size_t depot) const;
+        size_t getDepotOf(size_t vehicle) const;
+};
+
+#endif /* DEPOT_NETWORK_H */
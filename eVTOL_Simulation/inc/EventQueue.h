@@ -0,0 +1,55 @@
+/**
+ * @file EventQueue.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <cstddef>
+#include <queue>
+#include <vector>
+
+enum class EventType {
+    BATTERY_DEPLETED,
+    QUEUE_ADMISSION,
+    CHARGE_COMPLETE,
+    FAULT
+};
+
+// Used for events that are not tied to a vehicle or charger
+constexpr size_t NO_INDEX = (size_t)-1;
+
+struct Event {
+    double timeMs;
+    unsigned long sequence;
+    EventType type;
+    size_t vehicle;
+    size_t charger;
+    size_t depot;
+};
+
+class EventQueue {
+    private:
+        // Orders events by time; ties keep the order they were scheduled in
+        struct Later {
+            bool operator()(const Event &a, const Event &b) const;
+        };
+        std::priority_queue<Event, std::vector<Event>, Later> _events;
+        unsigned long _nextSequence = 0;
+    public:
+        void schedule(double timeMs, EventType type, size_t vehicle = NO_INDEX, size_t charger = NO_INDEX, size_t depot = NO_INDEX);
+        Event pop();
+        double peekTime() const;
+        bool isEmpty() const;
+        size_t size() const;
+        std::vector<Event> getPending() const;
+        unsigned long getNextSequence() const;
+        void restore(const std::vector<Event> &events, unsigned long nextSequence);
+};
+
+#endif /* EVENT_QUEUE_H */
@@ -0,0 +1,46 @@
+/**
+ * @file FaultScheduler.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef FAULT_SCHEDULER_H
+#define FAULT_SCHEDULER_H
+
+#include "Philox.h"
+#include <cstddef>
+#include <queue>
+#include <vector>
+
+// Faults are a Poisson process with a fixed rate per vehicle type, so the
+// time to a vehicle's next fault is exponential. The scheduler draws that
+// time once per fault instead of testing every vehicle on every tick.
+class FaultScheduler {
+    private:
+        struct Fault {
+            double timeMs;
+            size_t vehicle;
+        };
+
+        // Orders faults by time; ties go to the lower vehicle index
+        struct Later {
+            bool operator()(const Fault &a, const Fault &b) const;
+        };
+
+        Philox &_rng;
+        std::vector<double> _rate;
+        std::priority_queue<Fault, std::vector<Fault>, Later> _faults;
+    public:
+        explicit FaultScheduler(Philox &rng);
+        void clear();
+        void addVehicle(size_t vehicle, double rate);
+        double drawFaultTime(size_t vehicle, double nowMs);
+        void start(double nowMs);
+        void collectDue(double nowMs, std::vector<size_t> &faulted);
+        double peekTime() const;
+};
+
+#endif /* FAULT_SCHEDULER_H */
@@ -0,0 +1,367 @@
+/**
+ * @file FixedFleetKernels.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef FIXED_FLEET_KERNELS_H
+#define FIXED_FLEET_KERNELS_H
+
+#include "main.h"
+#include "FleetKernels.h"
+#include "VehicleRegistry.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Vehicle types known at compile time, in registry order. Each spec is a
+// struct of static constexpr members matching a row of the vehicle config:
+// NAME, CRUISE_SPEED, BATTERY_CAPACITY, TIME_TO_CHARGE, ENERGY_USE_PER_MI,
+// PASSENGER_COUNT and FAULT_PROBABILITY.
+template <typename... Specs>
+struct TypeList {};
+
+// Per ms and per hr rates of a compile-time spec, worked out the same way
+// the registry and battery work them out at run time so both kernel paths
+// give identical results
+template <typename Spec>
+struct FixedRates {
+    static constexpr double ENERGY_USE_PER_MS = Spec::ENERGY_USE_PER_MI * Spec::CRUISE_SPEED / HR_TO_MS(1);
+    static constexpr double CHARGE_RATE_PER_MS = (double)Spec::BATTERY_CAPACITY / HR_TO_MS(Spec::TIME_TO_CHARGE);
+    static constexpr double CAPACITY = Spec::BATTERY_CAPACITY;
+    static constexpr double PASSENGER_MPH = (double)Spec::CRUISE_SPEED * (double)Spec::PASSENGER_COUNT;
+};
+
+template <typename List> class FixedFleetKernels;
+
+// Drain and charge kernels for a fleet whose vehicle types are fixed at
+// compile time. The rates of each type are folded into constants, so the
+// kernels stream only the charge, status and totals of a vehicle instead of
+// also reading its copy of the rates. A run of vehicles of one type long
+// enough to pay for the dispatch gets a loop with that type's rates as
+// constants; shorter runs are stepped by the runtime kernels, which beat
+// gathering the rates by type. FleetState::addFleet groups the slots by
+// type, so a simulated fleet is stepped as one run per type.
+//
+// The registry must hold exactly the listed types in the same order, which
+// matches() checks before the kernels are handed to a simulation.
+template <typename... Specs>
+class FixedFleetKernels<TypeList<Specs...>> : public FleetKernels {
+    private:
+        template <typename Spec>
+        static void drainRange(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &depleted);
+        template <typename Spec>
+        static void chargeRange(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &full);
+        template <size_t... I>
+        static void drainDispatch(std::index_sequence<I...>, VehicleType type, FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &depleted);
+        template <size_t... I>
+        static void chargeDispatch(std::index_sequence<I...>, VehicleType type, FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &full);
+        template <typename Spec>
+        static bool specMatches(const VehicleSpec &spec);
+    public:
+        void drainFlying(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &depleted) const override;
+        void chargeCharging(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &full) const override;
+        static bool matches(const VehicleRegistry &registry);
+};
+
+/**
+ * @brief Drains the flying batteries in a range of the fleet
+ * 
+ * Long runs of one type use that type's constant loop, the rest of the range
+ * uses the runtime kernel. The runs are stepped in slot order, so the depleted
+ * vehicles are appended in the same order as by the runtime kernels.
+ * 
+ * @param fleet Fleet to drain
+ * @param ms Time in milliseconds flown
+ * @param begin First slot of the range
+ * @param end Slot one past the last of the range
+ * @param depleted Indices of vehicles whose battery emptied are appended here
+ */
+template <typename... Specs>
+void FixedFleetKernels<TypeList<Specs...>>::drainFlying(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &depleted) const {
+    const auto &runs = fleet.getTypeRuns();
+    auto run = std::upper_bound(runs.begin(), runs.end(), begin,
+        [](size_t index, const TypeRun &r) { return index < r.end; });
+
+    size_t mixed = begin;
+    for(; run != runs.end() && run->begin < end; ++run) {
+        size_t runBegin = (run->begin > begin) ? run->begin : begin;
+        size_t runEnd = (run->end < end) ? run->end : end;
+        if(runEnd - runBegin < MIN_TYPE_RUN_LENGTH) continue;
+
+        // Step the short runs collected before this one, then this run
+        if(mixed < runBegin) fleet.drainFlying(ms, mixed, runBegin, depleted);
+        drainDispatch(std::index_sequence_for<Specs...>{}, run->type, fleet, ms, runBegin, runEnd, depleted);
+        mixed = runEnd;
+    }
+    if(mixed < end) fleet.drainFlying(ms, mixed, end, depleted);
+}
+
+/**
+ * @brief Charges the batteries on a charger in a range of the fleet
+ * 
+ * @param fleet Fleet to charge
+ * @param ms Time in milliseconds spent charging
+ * @param begin First slot of the range
+ * @param end Slot one past the last of the range
+ * @param full Indices of vehicles whose battery filled are appended here
+ */
+template <typename... Specs>
+void FixedFleetKernels<TypeList<Specs...>>::chargeCharging(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &full) const {
+    const auto &runs = fleet.getTypeRuns();
+    auto run = std::upper_bound(runs.begin(), runs.end(), begin,
+        [](size_t index, const TypeRun &r) { return index < r.end; });
+
+    size_t mixed = begin;
+    for(; run != runs.end() && run->begin < end; ++run) {
+        size_t runBegin = (run->begin > begin) ? run->begin : begin;
+        size_t runEnd = (run->end < end) ? run->end : end;
+        if(runEnd - runBegin < MIN_TYPE_RUN_LENGTH) continue;
+
+        if(mixed < runBegin) fleet.chargeCharging(ms, mixed, runBegin, full);
+        chargeDispatch(std::index_sequence_for<Specs...>{}, run->type, fleet, ms, runBegin, runEnd, full);
+        mixed = runEnd;
+    }
+    if(mixed < end) fleet.chargeCharging(ms, mixed, end, full);
+}
+
+/**
+ * @brief Checks that a registry holds exactly the compile-time types, in
+ * order and with the same specs
+ * 
+ * @param registry Registry loaded from the vehicle config
+ * @return true if the fixed kernels can step a fleet built from it
+ */
+template <typename... Specs>
+bool FixedFleetKernels<TypeList<Specs...>>::matches(const VehicleRegistry &registry) {
+    if(registry.size() != sizeof...(Specs)) return false;
+    VehicleType type = 0;
+    bool same = true;
+    ((same = same && specMatches<Specs>(registry[type++])), ...);
+    return same;
+}
+
+/*******************Private Member Methods***********************/
+/**
+ * @brief Drains the flying batteries in a run of vehicles of one listed type
+ *
+ * @tparam Spec Compile-time spec of every vehicle in the run
+ * @param fleet Fleet to drain
+ * @param ms Time in milliseconds flown
+ * @param begin First slot of the range
+ * @param end Slot one past the last of the range
+ * @param depleted Indices of vehicles whose battery emptied are appended here
+ */
+template <typename... Specs>
+template <typename Spec>
+void FixedFleetKernels<TypeList<Specs...>>::drainRange(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &depleted) {
+    const double used = FixedRates<Spec>::ENERGY_USE_PER_MS * ms;
+    const double miles = FixedRates<Spec>::PASSENGER_MPH * MS_TO_HR(ms);
+    const VehicleStatus *status = fleet._status.data();
+    double *charge = fleet._chargeKwh.data();
+    double *flight = fleet._timeInFlightMs.data();
+    double *distance = fleet._distanceAllPassengersMi.data();
+    const size_t *vehicle = fleet._vehicle.data();
+    size_t i = begin;
+
+#if defined(__AVX2__)
+    const __m256d step = _mm256_set1_pd(ms);
+    const __m256d usedVec = _mm256_set1_pd(used);
+    const __m256d milesVec = _mm256_set1_pd(miles);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256i flying = _mm256_set1_epi64x((long long)VehicleStatus::FLYING);
+    for(; i + 4 <= end; i += 4) {
+
+        // Widen four status bytes into a mask of the flying lanes
+        int packed;
+        std::memcpy(&packed, &status[i], sizeof(packed));
+        __m256i lanes = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed));
+        __m256d mask = _mm256_castsi256_pd(_mm256_cmpeq_epi64(lanes, flying));
+
+        __m256d current = _mm256_loadu_pd(&charge[i]);
+        __m256d drained = _mm256_max_pd(_mm256_sub_pd(current, usedVec), zero);
+        _mm256_storeu_pd(&charge[i], _mm256_blendv_pd(current, drained, mask));
+        _mm256_storeu_pd(&flight[i], _mm256_add_pd(_mm256_loadu_pd(&flight[i]), _mm256_and_pd(step, mask)));
+        _mm256_storeu_pd(&distance[i], _mm256_add_pd(_mm256_loadu_pd(&distance[i]), _mm256_and_pd(milesVec, mask)));
+
+        int empty = _mm256_movemask_pd(_mm256_and_pd(_mm256_cmp_pd(drained, zero, _CMP_LE_OQ), mask));
+        for(int lane = 0; empty; lane++, empty >>= 1) {
+            if(empty & 1) depleted.push_back(vehicle[i + lane]);
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128d step = _mm_set1_pd(ms);
+    const __m128d usedVec = _mm_set1_pd(used);
+    const __m128d milesVec = _mm_set1_pd(miles);
+    const __m128d zero = _mm_setzero_pd();
+    for(; i + 2 <= end; i += 2) {
+
+        // Build a mask of the flying lanes
+        __m128d mask = _mm_castsi128_pd(_mm_set_epi64x(
+            -(long long)(status[i + 1] == VehicleStatus::FLYING),
+            -(long long)(status[i] == VehicleStatus::FLYING)));
+
+        __m128d current = _mm_loadu_pd(&charge[i]);
+        __m128d drained = _mm_max_pd(_mm_sub_pd(current, usedVec), zero);
+        _mm_storeu_pd(&charge[i], _mm_or_pd(_mm_and_pd(mask, drained), _mm_andnot_pd(mask, current)));
+        _mm_storeu_pd(&flight[i], _mm_add_pd(_mm_loadu_pd(&flight[i]), _mm_and_pd(step, mask)));
+        _mm_storeu_pd(&distance[i], _mm_add_pd(_mm_loadu_pd(&distance[i]), _mm_and_pd(milesVec, mask)));
+
+        int empty = _mm_movemask_pd(_mm_and_pd(_mm_cmple_pd(drained, zero), mask));
+        if(empty & 1) depleted.push_back(vehicle[i]);
+        if(empty & 2) depleted.push_back(vehicle[i + 1]);
+    }
+#endif
+
+    // Scalar fallback and tail of the vector loops
+    for(; i < end; i++) {
+        if(status[i] != VehicleStatus::FLYING) continue;
+        double drained = charge[i] - used;
+        charge[i] = (drained < 0.0) ? 0.0 : drained;
+        flight[i] += ms;
+        distance[i] += miles;
+        if(charge[i] <= 0.0) depleted.push_back(vehicle[i]);
+    }
+}
+
+/**
+ * @brief Charges the batteries on a charger in a run of vehicles of one
+ * listed type
+ *
+ * @tparam Spec Compile-time spec of every vehicle in the run
+ * @param fleet Fleet to charge
+ * @param ms Time in milliseconds spent charging
+ * @param begin First slot of the range
+ * @param end Slot one past the last of the range
+ * @param full Indices of vehicles whose battery filled are appended here
+ */
+template <typename... Specs>
+template <typename Spec>
+void FixedFleetKernels<TypeList<Specs...>>::chargeRange(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &full) {
+    const double added = FixedRates<Spec>::CHARGE_RATE_PER_MS * ms;
+    constexpr double capacity = FixedRates<Spec>::CAPACITY;
+    const VehicleStatus *status = fleet._status.data();
+    double *charge = fleet._chargeKwh.data();
+    double *charging = fleet._timeChargingMs.data();
+    const size_t *vehicle = fleet._vehicle.data();
+    size_t i = begin;
+
+#if defined(__AVX2__)
+    const __m256d step = _mm256_set1_pd(ms);
+    const __m256d addedVec = _mm256_set1_pd(added);
+    const __m256d capacityVec = _mm256_set1_pd(capacity);
+    const __m256i onCharger = _mm256_set1_epi64x((long long)VehicleStatus::CHARGING);
+    for(; i + 4 <= end; i += 4) {
+
+        // Widen four status bytes into a mask of the charging lanes
+        int packed;
+        std::memcpy(&packed, &status[i], sizeof(packed));
+        __m256i lanes = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed));
+        __m256d mask = _mm256_castsi256_pd(_mm256_cmpeq_epi64(lanes, onCharger));
+
+        __m256d current = _mm256_loadu_pd(&charge[i]);
+        __m256d charged = _mm256_min_pd(_mm256_add_pd(current, addedVec), capacityVec);
+        _mm256_storeu_pd(&charge[i], _mm256_blendv_pd(current, charged, mask));
+        _mm256_storeu_pd(&charging[i], _mm256_add_pd(_mm256_loadu_pd(&charging[i]), _mm256_and_pd(step, mask)));
+
+        int filled = _mm256_movemask_pd(_mm256_and_pd(_mm256_cmp_pd(charged, capacityVec, _CMP_GE_OQ), mask));
+        for(int lane = 0; filled; lane++, filled >>= 1) {
+            if(filled & 1) full.push_back(vehicle[i + lane]);
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128d step = _mm_set1_pd(ms);
+    const __m128d addedVec = _mm_set1_pd(added);
+    const __m128d capacityVec = _mm_set1_pd(capacity);
+    for(; i + 2 <= end; i += 2) {
+
+        // Build a mask of the charging lanes
+        __m128d mask = _mm_castsi128_pd(_mm_set_epi64x(
+            -(long long)(status[i + 1] == VehicleStatus::CHARGING),
+            -(long long)(status[i] == VehicleStatus::CHARGING)));
+
+        __m128d current = _mm_loadu_pd(&charge[i]);
+        __m128d charged = _mm_min_pd(_mm_add_pd(current, addedVec), capacityVec);
+        _mm_storeu_pd(&charge[i], _mm_or_pd(_mm_and_pd(mask, charged), _mm_andnot_pd(mask, current)));
+        _mm_storeu_pd(&charging[i], _mm_add_pd(_mm_loadu_pd(&charging[i]), _mm_and_pd(step, mask)));
+
+        int filled = _mm_movemask_pd(_mm_and_pd(_mm_cmpge_pd(charged, capacityVec), mask));
+        if(filled & 1) full.push_back(vehicle[i]);
+        if(filled & 2) full.push_back(vehicle[i + 1]);
+    }
+#endif
+
+    // Scalar fallback and tail of the vector loops
+    for(; i < end; i++) {
+        if(status[i] != VehicleStatus::CHARGING) continue;
+        double charged = charge[i] + added;
+        charge[i] = (charged > capacity) ? capacity : charged;
+        charging[i] += ms;
+        if(charge[i] >= capacity) full.push_back(vehicle[i]);
+    }
+}
+
+/**
+ * @brief Runs the drain loop of the listed type matching a run's type
+ * 
+ * @param type Type of every vehicle in the run
+ * @param fleet Fleet to drain
+ * @param ms Time in milliseconds flown
+ * @param begin First slot of the run
+ * @param end Slot one past the last of the run
+ * @param depleted Indices of vehicles whose battery emptied are appended here
+ */
+template <typename... Specs>
+template <size_t... I>
+void FixedFleetKernels<TypeList<Specs...>>::drainDispatch(std::index_sequence<I...>, VehicleType type, FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &depleted) {
+    ((type == I && (drainRange<Specs>(fleet, ms, begin, end, depleted), true)) || ...);
+}
+
+/**
+ * @brief Runs the charge loop of the listed type matching a run's type
+ * 
+ * @param type Type of every vehicle in the run
+ * @param fleet Fleet to charge
+ * @param ms Time in milliseconds spent charging
+ * @param begin First slot of the run
+ * @param end Slot one past the last of the run
+ * @param full Indices of vehicles whose battery filled are appended here
+ */
+template <typename... Specs>
+template <size_t... I>
+void FixedFleetKernels<TypeList<Specs...>>::chargeDispatch(std::index_sequence<I...>, VehicleType type, FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &full) {
+    ((type == I && (chargeRange<Specs>(fleet, ms, begin, end, full), true)) || ...);
+}
+
+/**
+ * @brief Checks one registry spec against a compile-time spec
+ * 
+ * @tparam Spec Compile-time spec
+ * @param spec Spec loaded from the vehicle config
+ * @return true if every field is the same and the spec charges linearly,
+ * as the constant charge rates assume
+ */
+template <typename... Specs>
+template <typename Spec>
+bool FixedFleetKernels<TypeList<Specs...>>::specMatches(const VehicleSpec &spec) {
+    return spec.name == Spec::NAME &&
+        spec.cruiseSpeedMph == Spec::CRUISE_SPEED &&
+        spec.batteryCapacityKwh == Spec::BATTERY_CAPACITY &&
+        spec.timeToChargeHr == Spec::TIME_TO_CHARGE &&
+        spec.energyUsePerMiKwh == Spec::ENERGY_USE_PER_MI &&
+        spec.passengerCount == Spec::PASSENGER_COUNT &&
+        spec.faultProbability == Spec::FAULT_PROBABILITY &&
+        !spec.chargeCurve;
+}
+
+#endif /* FIXED_FLEET_KERNELS_H */
@@ -0,0 +1,27 @@
+/**
+ * @file FleetKernels.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef FLEET_KERNELS_H
+#define FLEET_KERNELS_H
+
+#include "FleetState.h"
+#include <cstddef>
+#include <vector>
+
+// Drain and charge kernels the polling loop runs over a range of the fleet.
+// The base class runs the FleetState kernels, which read every vehicle's
+// rates from the arrays and so work with any specs loaded at run time.
+class FleetKernels {
+    public:
+        virtual ~FleetKernels() = default;
+        virtual void drainFlying(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &depleted) const;
+        virtual void chargeCharging(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &full) const;
+};
+
+#endif /* FLEET_KERNELS_H */
@@ -0,0 +1,125 @@
+/**
+ * @file FleetState.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef FLEET_STATE_H
+#define FLEET_STATE_H
+
+#include "Vehicle.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+enum class VehicleStatus : uint8_t {
+    FLYING,
+    QUEUED,
+    CHARGING
+};
+constexpr size_t VEHICLE_STATUS_COUNT = 3;
+
+// Marks the end of a status list
+constexpr size_t END_OF_LIST = (size_t)-1;
+
+// Runs of one type shorter than this are not worth a kernel of their own
+constexpr size_t MIN_TYPE_RUN_LENGTH = 32;
+
+// Consecutive slots holding vehicles of the same type, [begin, end)
+struct TypeRun {
+    size_t begin;
+    size_t end;
+    VehicleType type;
+};
+
+template <typename List> class FixedFleetKernels;
+
+// Structure-of-arrays copy of the fleet used by the polling loop. Every
+// vehicle is an index into contiguous arrays, so the drain and charge
+// kernels walk memory linearly and can be vectorized.
+//
+// A vehicle whose charger tapers charges along its type's charge curve.
+// While it is on the charger its charge array entry holds its time on the
+// curve scaled by the average rate of a full charge, which the charge
+// kernels step like any linear charge and which reaches the capacity just
+// as the battery fills. It is converted to and from the real charge as the
+// vehicle goes on and off the charger.
+//
+// Vehicles are stored in slots, which addFleet orders by type so the
+// compile-time kernels get one long run per type. Every method but the
+// kernels' begin and end takes and returns fleet indices, so callers never
+// see the slots, and the kernels report vehicles by fleet index.
+//
+// A vehicle keeps its slot for the whole run. Besides its status byte it
+// sits on an intrusive doubly linked list of the vehicles in its group
+// (e.g. depot) with the same status, so a status change is an O(1) relink
+// with no allocation. Groups never share a list, so the status of vehicles
+// in different groups can be changed from different threads. chargeGroup
+// walks a group's charging list, so charging costs the chargers in use
+// rather than a scan of the fleet.
+class FleetState {
+    private:
+        // Compile-time kernels work on the arrays directly
+        template <typename List> friend class FixedFleetKernels;
+
+        std::vector<TypeRun> _runs;
+        // Status lists, indexed by group * VEHICLE_STATUS_COUNT + status
+        std::vector<size_t> _head;
+        std::vector<size_t> _count;
+        std::vector<size_t> _next;
+        std::vector<size_t> _prev;
+        std::vector<size_t> _group;
+        std::vector<size_t> _vehicle;       // Fleet index of each slot
+        std::vector<size_t> _slot;          // Slot of each fleet index
+        void link(size_t slot);
+        void unlink(size_t slot);
+
+        std::vector<double> _chargeKwh;
+        std::vector<double> _capacityKwh;
+        std::vector<double> _energyUseKwh;
+        std::vector<double> _chargeRateKwh;
+        std::vector<double> _cruiseSpeedMph;
+        std::vector<double> _passengerCount;
+        std::vector<VehicleStatus> _status;
+        std::vector<VehicleType> _type;
+        std::vector<const ChargeCurve *> _chargeCurve;
+
+        // Per vehicle totals accumulated by the kernels
+        std::vector<double> _timeInFlightMs;
+        std::vector<double> _distanceAllPassengersMi;
+        std::vector<double> _timeChargingMs;
+        std::vector<double> _timeAwaitingChargeMs;
+    public:
+        void reserve(size_t count);
+        size_t addVehicle(const Vehicle &vehicle, size_t group = 0);
+        size_t addVehicle(const Vehicle &vehicle, size_t group, size_t index);
+        void addFleet(const std::vector<std::shared_ptr<Vehicle>> &vehicles, const std::function<size_t(size_t)> &groupOf);
+        size_t size() const;
+        double getCharge(size_t index) const;
+        void setCharge(size_t index, double kwh);
+        double getCapacity(size_t index) const;
+        VehicleType getType(size_t index) const;
+        const std::vector<TypeRun> &getTypeRuns() const;
+        VehicleStatus getStatus(size_t index) const;
+        void setStatus(size_t index, VehicleStatus status);
+        size_t getGroup(size_t index) const;
+        size_t getStatusCount(VehicleStatus status) const;
+        size_t getStatusCount(size_t group, VehicleStatus status) const;
+        double getTimeInFlight(size_t index) const;
+        double getDistanceAllPassengers(size_t index) const;
+        double getTimeCharging(size_t index) const;
+        double getTimeAwaitingCharge(size_t index) const;
+        void addTimeAwaitingCharge(size_t index, double ms);
+        void drainFlying(double ms, std::vector<size_t> &depleted);
+        void drainFlying(double ms, size_t begin, size_t end, std::vector<size_t> &depleted);
+        void chargeCharging(double ms, std::vector<size_t> &full);
+        void chargeCharging(double ms, size_t begin, size_t end, std::vector<size_t> &full);
+        void chargeGroup(double ms, size_t group, std::vector<size_t> &full);
+};
+
+#endif /* FLEET_STATE_H */
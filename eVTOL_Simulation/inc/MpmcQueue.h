@@ -0,0 +1,147 @@
+/**
+ * @file MpmcQueue.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include "CacheLine.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+// Bounded lock-free multi-producer/multi-consumer queue. Each cell carries a
+// sequence number that tells a producer or consumer whether the cell is its
+// turn, so push and pop only race on a single compare-and-swap of their own
+// position counter and never take a lock. The head and tail counters sit on
+// separate cache lines so producers and consumers do not contend.
+template <typename T>
+class MpmcQueue {
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T data;
+        };
+
+        std::unique_ptr<Cell[]> _cells;
+        size_t _mask = 0;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> _enqueuePos{0};
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> _dequeuePos{0};
+    public:
+        explicit MpmcQueue(size_t capacity = 1);
+        MpmcQueue(const MpmcQueue &) = delete;
+        MpmcQueue &operator=(const MpmcQueue &) = delete;
+        void reset(size_t capacity);
+        size_t capacity() const;
+        bool push(const T &item);
+        bool pop(T &item);
+};
+
+/**
+ * @brief Construct a new Mpmc Queue object
+ * 
+ * @param capacity Minimum number of items the queue holds at once
+ */
+template <typename T>
+MpmcQueue<T>::MpmcQueue(size_t capacity) {
+    reset(capacity);
+}
+
+/**
+ * @brief Empties the queue and resizes it. Not thread safe, call only while
+ * no other thread is using the queue.
+ * 
+ * @param capacity Minimum number of items the queue holds at once, rounded
+ * up to a power of two
+ */
+template <typename T>
+void MpmcQueue<T>::reset(size_t capacity) {
+    size_t size = 2;
+    while(size < capacity) size <<= 1;
+    if(size != _mask + 1) {
+        _cells = std::make_unique<Cell[]>(size);
+        _mask = size - 1;
+    }
+    for(size_t i = 0; i < size; i++) {
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    _enqueuePos.store(0, std::memory_order_relaxed);
+    _dequeuePos.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Gets the number of items the queue holds at once
+ * 
+ * @return size_t 
+ */
+template <typename T>
+size_t MpmcQueue<T>::capacity() const {
+    return _mask + 1;
+}
+
+/**
+ * @brief Adds an item to the back of the queue, safe from any thread
+ * 
+ * @param item Item to add
+ * @return true The item was added
+ * @return false The queue is full
+ */
+template <typename T>
+bool MpmcQueue<T>::push(const T &item) {
+    size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+    Cell *cell;
+    for(;;) {
+        cell = &_cells[pos & _mask];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        auto diff = (std::ptrdiff_t)sequence - (std::ptrdiff_t)pos;
+        if(diff == 0) {
+            // The cell is free, claim it by moving the tail past it
+            if(_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if(diff < 0) {
+            // The consumer has not freed the cell a lap ago, the queue is full
+            return false;
+        } else {
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    cell->data = item;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Removes the item at the front of the queue, safe from any thread
+ * 
+ * @param item Set to the removed item
+ * @return true An item was removed
+ * @return false The queue is empty
+ */
+template <typename T>
+bool MpmcQueue<T>::pop(T &item) {
+    size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+    Cell *cell;
+    for(;;) {
+        cell = &_cells[pos & _mask];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        auto diff = (std::ptrdiff_t)sequence - (std::ptrdiff_t)(pos + 1);
+        if(diff == 0) {
+            // The cell is filled, claim it by moving the head past it
+            if(_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if(diff < 0) {
+            // The producer has not filled the cell yet, the queue is empty
+            return false;
+        } else {
+            pos = _dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+    item = cell->data;
+    cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+    return true;
+}
+
+#endif /* MPMC_QUEUE_H */
@@ -0,0 +1,55 @@
+/**
+ * @file Philox.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef PHILOX_H
+#define PHILOX_H
+
+#include <array>
+#include <cstdint>
+
+// Philox4x32-10 counter-based random number generator (Salmon et al.,
+// "Parallel Random Numbers: As Easy as 1, 2, 3"). Every output is a pure
+// function of (seed, stream, counter), so any number can be computed
+// directly from its counter in any order or on any thread, and a seed
+// reproduces a run exactly. Also usable as a sequential generator with the
+// standard <random> distributions.
+class Philox {
+    private:
+        uint64_t _seed;
+        uint64_t _stream;
+        uint64_t _counter = 0;
+        std::array<uint32_t, 4> _buffer{};
+        unsigned _buffered = 0;
+    public:
+        using result_type = uint32_t;
+        using Block = std::array<uint32_t, 4>;
+
+        // Everything that places the generator in its stream, for checkpoints
+        struct State {
+            uint64_t seed;
+            uint64_t stream;
+            uint64_t counter;
+            Block buffer;
+            unsigned buffered;
+        };
+
+        explicit Philox(uint64_t seed = 0, uint64_t stream = 0);
+        Block block(uint64_t counter) const;
+        result_type operator()();
+        double nextDouble();
+        static double toDouble(uint32_t high, uint32_t low);
+        uint64_t getSeed() const;
+        uint64_t getStream() const;
+        State getState() const;
+        void setState(const State &state);
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return UINT32_MAX; }
+};
+
+#endif /* PHILOX_H */
@@ -0,0 +1,70 @@
+/**
+ * @file ProductionFleet.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef PRODUCTION_FLEET_H
+#define PRODUCTION_FLEET_H
+
+#include "FixedFleetKernels.h"
+
+// Compile-time copy of config/vehicles.csv, used by the fixed kernels. Keep
+// in step with the config file; a mismatch is caught at startup.
+struct AlphaSpec {
+    static constexpr const char *NAME = "Alpha";
+    static constexpr int CRUISE_SPEED = 120;
+    static constexpr int BATTERY_CAPACITY = 320;
+    static constexpr double TIME_TO_CHARGE = 0.6;
+    static constexpr double ENERGY_USE_PER_MI = 1.6;
+    static constexpr int PASSENGER_COUNT = 4;
+    static constexpr double FAULT_PROBABILITY = 0.25;
+};
+
+struct BetaSpec {
+    static constexpr const char *NAME = "Beta";
+    static constexpr int CRUISE_SPEED = 100;
+    static constexpr int BATTERY_CAPACITY = 100;
+    static constexpr double TIME_TO_CHARGE = 0.2;
+    static constexpr double ENERGY_USE_PER_MI = 1.5;
+    static constexpr int PASSENGER_COUNT = 5;
+    static constexpr double FAULT_PROBABILITY = 0.10;
+};
+
+struct CharlieSpec {
+    static constexpr const char *NAME = "Charlie";
+    static constexpr int CRUISE_SPEED = 160;
+    static constexpr int BATTERY_CAPACITY = 220;
+    static constexpr double TIME_TO_CHARGE = 0.8;
+    static constexpr double ENERGY_USE_PER_MI = 2.2;
+    static constexpr int PASSENGER_COUNT = 3;
+    static constexpr double FAULT_PROBABILITY = 0.05;
+};
+
+struct DeltaSpec {
+    static constexpr const char *NAME = "Delta";
+    static constexpr int CRUISE_SPEED = 90;
+    static constexpr int BATTERY_CAPACITY = 120;
+    static constexpr double TIME_TO_CHARGE = 0.62;
+    static constexpr double ENERGY_USE_PER_MI = 0.8;
+    static constexpr int PASSENGER_COUNT = 2;
+    static constexpr double FAULT_PROBABILITY = 0.22;
+};
+
+struct EchoSpec {
+    static constexpr const char *NAME = "Echo";
+    static constexpr int CRUISE_SPEED = 30;
+    static constexpr int BATTERY_CAPACITY = 150;
+    static constexpr double TIME_TO_CHARGE = 0.3;
+    static constexpr double ENERGY_USE_PER_MI = 5.8;
+    static constexpr int PASSENGER_COUNT = 2;
+    static constexpr double FAULT_PROBABILITY = 0.61;
+};
+
+using ProductionFleet = TypeList<AlphaSpec, BetaSpec, CharlieSpec, DeltaSpec, EchoSpec>;
+using ProductionKernels = FixedFleetKernels<ProductionFleet>;
+
+#endif /* PRODUCTION_FLEET_H */
@@ -0,0 +1,30 @@
+/**
+ * @file SampleStats.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef SAMPLE_STATS_H
+#define SAMPLE_STATS_H
+
+#include <cstddef>
+
+// Running mean and variance of a metric over many samples (Welford's method,
+// which stays accurate when the samples are close together)
+class SampleStats {
+    private:
+        size_t _count = 0;
+        double _mean = 0.0;
+        double _sumSquares = 0.0;
+    public:
+        void add(double sample);
+        size_t getCount() const;
+        double getMean() const;
+        double getVariance() const;
+        double getConfidence95() const;
+};
+
+#endif /* SAMPLE_STATS_H */
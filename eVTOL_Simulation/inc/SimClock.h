@@ -0,0 +1,66 @@
+/**
+ * @file SimClock.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <chrono>
+#include <memory>
+
+enum class ClockMode {
+    REAL_TIME,
+    SCALED,
+    FAST
+};
+
+// Simulation time source. All times are milliseconds of simulated time, which
+// a reset restarts from a given time. The simulation loop drives the clock
+// with advanceTo.
+class SimClock {
+    public:
+        virtual ~SimClock() = default;
+        virtual void reset(long long simMs = 0) = 0;
+        virtual long long now() const = 0;
+        virtual void advanceTo(long long simMs) = 0;
+        virtual bool isPaced() const = 0;
+        static std::unique_ptr<SimClock> create(ClockMode mode, double scale);
+};
+
+// Runs simulated time at a fixed multiple of wall time
+class ScaledClock : public SimClock {
+    private:
+        double _scale;
+        std::chrono::steady_clock::time_point _start;
+    public:
+        explicit ScaledClock(double scale);
+        void reset(long long simMs = 0) override;
+        long long now() const override;
+        void advanceTo(long long simMs) override;
+        bool isPaced() const override;
+        double getScale() const;
+};
+
+// Runs simulated time at wall time, 1 hr = 1 hr
+class RealTimeClock : public ScaledClock {
+    public:
+        RealTimeClock();
+};
+
+// Runs simulated time as fast as the simulation loop can advance it
+class FastClock : public SimClock {
+    private:
+        long long _now = 0;
+    public:
+        void reset(long long simMs = 0) override;
+        long long now() const override;
+        void advanceTo(long long simMs) override;
+        bool isPaced() const override;
+};
+
+#endif /* SIM_CLOCK_H */
@@ -1,32 +1,97 @@
-/**
- * @file Simulation.h
- * @author Adrian Deardorff (80deardorff@gmail.com)
- * @version 0.1
- * @date 2022-05-11
- * 
- * @copyright Copyright (c) 2022
- * 
- */
-#ifndef SIMULATION_H
-#define SIMULATION_H
-
-#include "Vehicle.h"
-#include "Charger.h"
-#include <memory>
-#include <vector>
-
-class Simulation {
-    private:
-        long long _currTime;
-        long long _endTime;
-        long long getCurrentTime();
-        long long getTimeRemaining();
-        void printRemainingTime();
-    public:
-        void startSimulation(
-            std::vector<std::shared_ptr<Vehicle>> &vehiclesFlying,
-            const std::vector<std::unique_ptr<Charger>> &chargers, 
-            long ms);
-};
-
-#endif /* SIMULATION_H */
+/**
+ * @file Simulation.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2022-05-11
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "Vehicle.h"
+#include "VehicleRegistry.h"
+#include "DepotNetwork.h"
+#include "FleetKernels.h"
+#include "SimClock.h"
+#include "Philox.h"
+#include "FaultScheduler.h"
+#include "SimulationStats.h"
+#include "TelemetrySink.h"
+#include "ThreadPool.h"
+#include "Checkpoint.h"
+#include <memory>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct VehicleRecord;
+class EventQueue;
+
+// How well a paced polling run kept up with its clock. A tick is late when
+// it woke more than LATE_TICK_FRACTION of its step after its target time.
+struct PacingStats {
+    uint64_t ticks = 0;
+    uint64_t lateTicks = 0;
+    double totalLagMs = 0.0;        // Simulated ms behind the clock, summed
+    double maxLagMs = 0.0;
+    double maxStepMs = 0.0;         // Coarsest step the loop fell back to
+    double finalStepMs = 0.0;
+};
+
+class Simulation {
+    private:
+        SimClock &_clock;
+        const VehicleRegistry &_registry;
+        Philox _rng;
+        FaultScheduler _faults{_rng};
+        SimulationStats _stats;
+        PacingStats _pacing;
+        bool _showProgress = true;
+        ThreadPool *_stepPool = nullptr;
+        FleetKernels _runtimeKernels;
+        const FleetKernels *_kernels = &_runtimeKernels;
+        TelemetrySink *_telemetry = nullptr;
+        double _telemetryMs = 0.0;
+        double _nextSampleMs = 0.0;
+        std::string _checkpointFile;
+        double _checkpointMs = 0.0;
+        double _stepMs;
+        long long _currTime;
+        long long _endTime;
+        long long getCurrentTime();
+        long long getTimeRemaining();
+        void printRemainingTime();
+        void resetRun(const std::vector<std::shared_ptr<Vehicle>> &vehicles, DepotNetwork &depots, bool polling);
+        void runEvents(EventQueue &events, std::vector<VehicleRecord> &records, const std::vector<std::shared_ptr<Vehicle>> &vehicles, DepotNetwork &depots, double startMs, long ms);
+        bool writeCheckpoint(const EventQueue &events, const std::vector<VehicleRecord> &records, const std::vector<std::shared_ptr<Vehicle>> &vehicles, const DepotNetwork &depots, double nowMs) const;
+        bool matchesCheckpoint(const Checkpoint &checkpoint, const std::vector<std::shared_ptr<Vehicle>> &vehicles, const DepotNetwork &depots) const;
+    public:
+        Simulation(SimClock &clock, const VehicleRegistry &registry);
+        Simulation(SimClock &clock, const VehicleRegistry &registry, uint64_t seed, uint64_t stream = 0);
+        void setShowProgress(bool show);
+        void setStepPool(ThreadPool *pool);
+        void setStepMs(double ms);
+        void setKernels(const FleetKernels *kernels);
+        void setTelemetry(TelemetrySink *sink, double periodMs);
+        void setCheckpoint(const std::string &path, double atMs);
+        void startSimulation(
+            const std::vector<std::shared_ptr<Vehicle>> &vehicles,
+            DepotNetwork &depots,
+            long ms);
+        void startEventSimulation(
+            const std::vector<std::shared_ptr<Vehicle>> &vehicles,
+            DepotNetwork &depots,
+            long ms);
+        bool resumeEventSimulation(
+            const Checkpoint &checkpoint,
+            const std::vector<std::shared_ptr<Vehicle>> &vehicles,
+            DepotNetwork &depots,
+            long ms);
+        const SimulationStats &getStats() const;
+        const PacingStats &getPacingStats() const;
+        void printPacingStats() const;
+};
+
+#endif /* SIMULATION_H */
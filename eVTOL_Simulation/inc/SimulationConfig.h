@@ -0,0 +1,69 @@
+/**
+ * @file SimulationConfig.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef SIMULATION_CONFIG_H
+#define SIMULATION_CONFIG_H
+
+#include "ChargerPool.h"
+#include "SimClock.h"
+#include "TelemetrySink.h"
+#include "VehicleFactory.h"
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+
+// How results are written to the terminal
+enum class OutputFormat {
+    TEXT,
+    CSV
+};
+
+// Every setting of a run. Starts from the defaults in main.h and can be
+// overridden from the command line or a key = value config file, so a
+// parameter sweep needs no rebuild.
+struct SimulationConfig {
+    size_t vehicles;
+    FleetMix mix;
+    size_t depots;
+    size_t chargers;
+    QueuePolicy policy;
+    bool orderedArrivals;
+    double hours;
+    double stepMs;
+    uint64_t seed = 0;
+    bool hasSeed = false;
+    ClockMode clockMode;
+    double timeScale;
+    bool eventDriven;
+    size_t threads = 0;
+    size_t stepThreads;
+    bool fixedKernels;
+    size_t replicas;
+    std::string vehicleFile;
+    std::string telemetryFile;
+    TelemetryFormat telemetryFormat;
+    double telemetryMs;
+    std::string traceFile;
+    std::string checkpointFile;
+    double checkpointHours = 0.0;       // 0 for the end of the run
+    std::string restoreFile;
+    std::set<std::string> given;        // Keys set rather than defaulted
+    OutputFormat output = OutputFormat::TEXT;
+    bool showProgress = true;
+
+    SimulationConfig();
+    bool set(const std::string &key, const std::string &value);
+    bool loadFile(const std::string &path);
+    bool parseArgs(int argc, char **argv, bool &exit);
+    long getLengthMs() const;
+    static void printUsage(const char *program);
+};
+
+#endif /* SIMULATION_CONFIG_H */
@@ -0,0 +1,65 @@
+/**
+ * @file SimulationStats.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef SIMULATION_STATS_H
+#define SIMULATION_STATS_H
+
+#include "CacheLine.h"
+#include "Vehicle.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Totals for every vehicle of one company, each in its own cache line
+struct alignas(CACHE_LINE_SIZE) TypeStats {
+    std::string name;
+    int vehicleCount = 0;
+    double timeInFlightHr = 0.0;
+    double timeChargingHr = 0.0;
+    double timeAwaitingChargeHr = 0.0;
+    int faultCount = 0;
+    double distanceAllPassengersMi = 0.0;
+};
+
+// Totals for a single vehicle
+struct alignas(CACHE_LINE_SIZE) VehicleStats {
+    VehicleType type = 0;
+    double timeInFlightHr = 0.0;
+    double timeChargingHr = 0.0;
+    double timeAwaitingChargeHr = 0.0;
+    int faultCount = 0;
+    double distanceAllPassengersMi = 0.0;
+};
+
+// Statistics owned by one simulation, so any number of simulations can run
+// side by side without sharing state
+class SimulationStats {
+    private:
+        std::vector<TypeStats> _types;
+        std::vector<VehicleStats> _vehicles;
+    public:
+        void clear();
+        void reserve(size_t count);
+        size_t addVehicle(const Vehicle &vehicle);
+        void addTimeInFlight(size_t vehicle, double ms);
+        void addDistanceAllPassengers(size_t vehicle, double mi);
+        void addTimeCharging(size_t vehicle, double ms);
+        void addTimeAwaitingCharge(size_t vehicle, double ms);
+        void triggerFault(size_t vehicle);
+        void setTypeTotals(VehicleType type, const TypeStats &totals);
+        void setVehicleTotals(size_t vehicle, const VehicleStats &totals);
+        const TypeStats &getTypeStats(VehicleType type) const;
+        const VehicleStats &getVehicleStats(size_t vehicle) const;
+        size_t getTypeCount() const;
+        size_t getVehicleCount() const;
+        void printData() const;
+        void printCsv() const;
+};
+
+#endif /* SIMULATION_STATS_H */
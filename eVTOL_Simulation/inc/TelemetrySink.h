@@ -0,0 +1,105 @@
+/**
+ * @file TelemetrySink.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef TELEMETRY_SINK_H
+#define TELEMETRY_SINK_H
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Number of state of charge buckets, each 10% wide
+constexpr size_t TELEMETRY_SOC_BINS = 10;
+
+// Rows buffered before a chunk is handed to the writer thread
+constexpr size_t TELEMETRY_CHUNK_ROWS = 4096;
+
+// Chunks waiting on the writer before the simulation waits for it
+constexpr size_t TELEMETRY_MAX_QUEUED_CHUNKS = 64;
+
+enum class TelemetryFormat {
+    BINARY,
+    CSV
+};
+
+// Fleet metrics at one point in simulated time
+struct TelemetrySample {
+    double timeMs = 0.0;
+    uint64_t flying = 0;
+    uint64_t queued = 0;
+    uint64_t charging = 0;
+    double chargerUtilization = 0.0;    // Share of chargers in use
+    double distanceAllPassengersMi = 0.0; // Cumulative passenger miles
+    std::array<uint32_t, TELEMETRY_SOC_BINS> soc{}; // Vehicles per 10% of charge
+};
+
+// Streams fleet samples to a file from a background thread. Samples are
+// stored column by column in chunks of TELEMETRY_CHUNK_ROWS; a full chunk is
+// handed to the writer thread and the simulation carries on filling a
+// recycled one, so it only waits on the disk if the writer falls
+// TELEMETRY_MAX_QUEUED_CHUNKS behind.
+//
+// The binary format is in the machine's byte order (little endian on x86):
+//   header  "EVTLTLM1", uint32 column count, then per column a uint8 type
+//           (1 = f64, 2 = u64, 3 = u32), a uint8 name length and the name
+//   chunk   uint32 row count, then every column's values back to back
+// The CSV fallback writes the same columns one row per sample.
+class TelemetrySink {
+    private:
+        struct Chunk {
+            size_t rows = 0;
+            std::vector<double> timeMs;
+            std::vector<uint64_t> flying;
+            std::vector<uint64_t> queued;
+            std::vector<uint64_t> charging;
+            std::vector<double> chargerUtilization;
+            std::vector<double> distanceAllPassengersMi;
+            std::array<std::vector<uint32_t>, TELEMETRY_SOC_BINS> soc;
+
+            Chunk();
+            void clear();
+        };
+
+        std::ofstream _file;
+        TelemetryFormat _format = TelemetryFormat::BINARY;
+        std::unique_ptr<Chunk> _current;
+        std::vector<std::unique_ptr<Chunk>> _spare;
+        std::deque<std::unique_ptr<Chunk>> _ready;
+        std::mutex _mutex;
+        std::condition_variable _chunkReady;
+        std::condition_variable _chunkWritten;
+        std::thread _writer;
+        bool _closing = false;
+        uint64_t _rows = 0;
+
+        void handOff();
+        void writerLoop();
+        void writeHeader();
+        void writeChunk(const Chunk &chunk);
+    public:
+        TelemetrySink() = default;
+        ~TelemetrySink();
+        TelemetrySink(const TelemetrySink &) = delete;
+        TelemetrySink &operator=(const TelemetrySink &) = delete;
+        bool open(const std::string &path, TelemetryFormat format);
+        bool isOpen() const;
+        void record(const TelemetrySample &sample);
+        void close();
+        uint64_t getRowCount() const;
+};
+
+#endif /* TELEMETRY_SINK_H */
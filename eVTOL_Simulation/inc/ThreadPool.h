@@ -0,0 +1,54 @@
+/**
+ * @file ThreadPool.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing thread pool. Every worker has its own task queue and runs
+// from the back of it; a worker that runs dry steals from the front of the
+// other queues, so long and short tasks stay balanced across the cores.
+class ThreadPool {
+    private:
+        struct WorkQueue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<WorkQueue>> _queues;
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _taskReady;
+        std::condition_variable _allDone;
+        size_t _queued = 0;
+        size_t _pending = 0;
+        size_t _nextQueue = 0;
+        bool _stop = false;
+
+        bool popTask(size_t worker, std::function<void()> &task);
+        void workerLoop(size_t worker);
+    public:
+        explicit ThreadPool(size_t threads = std::thread::hardware_concurrency());
+        ~ThreadPool();
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+        void submit(std::function<void()> task);
+        void wait();
+        size_t size() const;
+};
+
+#endif /* THREAD_POOL_H */
@@ -0,0 +1,84 @@
+/**
+ * @file Trace.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "main.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Events kept per thread; later events are dropped and counted
+constexpr size_t TRACE_MAX_EVENTS_PER_THREAD = 1 << 22;
+
+// Scoped timers and counters for profiling the hot path. Every thread
+// records into its own buffer without locking, and the buffers are written
+// out together as Chrome trace JSON, which chrome://tracing and Perfetto
+// open. Use the TRACE_ macros below: with TRACE_MODE off they expand to
+// nothing, so an untraced build runs exactly the code it always did.
+class Tracer {
+    private:
+        struct Event {
+            const char *name;
+            uint64_t startNs;
+            uint64_t durationNs;        // Unused by counters
+            double value;               // Unused by scopes
+            bool counter;
+        };
+
+        struct ThreadBuffer {
+            size_t tid;
+            size_t dropped = 0;
+            std::vector<Event> events;
+        };
+
+        std::mutex _mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> _buffers;
+
+        Tracer() = default;
+        ThreadBuffer &getThreadBuffer();
+        void append(const Event &event);
+    public:
+        static Tracer &get();
+        static uint64_t now();
+        void addScope(const char *name, uint64_t startNs, uint64_t endNs);
+        void addCounter(const char *name, double value);
+        bool writeChromeJson(const std::string &path);
+};
+
+// Times the enclosing scope as one complete event
+class TraceScope {
+    private:
+        const char *_name;
+        uint64_t _startNs;
+    public:
+        explicit TraceScope(const char *name);
+        ~TraceScope();
+        TraceScope(const TraceScope &) = delete;
+        TraceScope &operator=(const TraceScope &) = delete;
+};
+
+uint64_t getThreadAllocations();
+
+#define TRACE_CONCAT_INNER(a, b)    a##b
+#define TRACE_CONCAT(a, b)          TRACE_CONCAT_INNER(a, b)
+
+#if TRACE_MODE
+#define TRACE_SCOPE(name)           TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_COUNTER(name, value)  Tracer::get().addCounter(name, (double)(value))
+#else
+#define TRACE_SCOPE(name)           ((void)0)
+#define TRACE_COUNTER(name, value)  ((void)0)
+#endif /* TRACE_MODE */
+
+#endif /* TRACE_H */
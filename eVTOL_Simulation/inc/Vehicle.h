@@ -1,45 +1,36 @@
-/**
- * @file Vehicle.h
- * @author Adrian Deardorff (80deardorff@gmail.com)
- * @version 0.1
- * @date 2022-05-11
- * 
- * @copyright Copyright (c) 2022
- * 
- */
-#ifndef VEHICLE_H
-#define VEHICLE_H
-
-#include "Battery.h"
-#include <memory>
-#include <string>
-
-class Vehicle {
-    private:
-        std::shared_ptr<Battery> _pBattery;
-        int _cruiseSpeedMph;
-        int _passengerCount;
-        double _faultProbability;
-    protected:
-        virtual ~Vehicle() = default;
-    public:
-        Vehicle(int capacityKwh, double timeToChargeHr, int cruiseSpeedMph, double energyUseKwh, int passengerCount, double faultProbability);
-        std::shared_ptr<Battery> getBattery() const;
-        virtual std::string getName() const = 0;
-        virtual int getVehicleCount() const = 0;
-        virtual double getTimeInFlight() const = 0;
-        virtual double getTimeCharging() const = 0;
-        virtual double getTimeAwaitingCharge() const = 0;
-        virtual int getFaultCount() const = 0;
-        virtual double getDistanceAllPassengers() const = 0;
-        virtual void addTimeInFlight(long ms) const = 0;
-        virtual void addTimeCharging(long ms) const = 0;
-        virtual void addTimeAwaitingCharge(long ms) const = 0;
-        virtual void triggerFault() const = 0;
-        int getCruiseSpeed() const;
-        int getPassengerCount() const;
-        double getFaultProbability() const;
-        void faultCheck() const;
-};
-
-#endif /* VEHICLE_H */
+/**
+ * @file Vehicle.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2022-05-11
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+#ifndef VEHICLE_H
+#define VEHICLE_H
+
+#include "Battery.h"
+#include "VehicleSpec.h"
+#include <string>
+
+// The battery is held by value, so its data sits right next to the vehicle
+// and a vehicle costs no allocation of its own beyond where it is placed
+class Vehicle {
+    private:
+        const VehicleSpec *_pSpec;
+        Battery _battery;
+    public:
+        explicit Vehicle(const VehicleSpec &spec);
+        Battery *getBattery();
+        const Battery *getBattery() const;
+        const VehicleSpec &getSpec() const;
+        const std::string &getName() const;
+        VehicleType getType() const;
+        int getCruiseSpeed() const;
+        int getPassengerCount() const;
+        double getFaultProbability() const;
+        double getFaultRate() const;
+};
+
+#endif /* VEHICLE_H */
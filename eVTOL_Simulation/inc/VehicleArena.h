@@ -0,0 +1,32 @@
+/**
+ * @file VehicleArena.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef VEHICLE_ARENA_H
+#define VEHICLE_ARENA_H
+
+#include "Vehicle.h"
+#include <cstddef>
+#include <vector>
+
+// Fixed size block that a whole fleet is placed into, one allocation for
+// every vehicle and battery. Vehicles never move once placed and are all
+// freed together when the arena is destroyed.
+class VehicleArena {
+    private:
+        std::vector<Vehicle> _vehicles;
+    public:
+        explicit VehicleArena(size_t capacity);
+        VehicleArena(const VehicleArena &) = delete;
+        VehicleArena &operator=(const VehicleArena &) = delete;
+        Vehicle *create(const VehicleSpec &spec);
+        size_t size() const;
+        size_t capacity() const;
+};
+
+#endif /* VEHICLE_ARENA_H */
@@ -1,30 +1,38 @@
-/**
- * @file VehicleFactory.h
- * @author Adrian Deardorff (80deardorff@gmail.com)
- * @version 0.1
- * @date 2022-05-11
- * 
- * @copyright Copyright (c) 2022
- * 
- */
-#ifndef VEHICLE_FACTORY_H
-#define VEHICLE_FACTORY_H
-
-#include <memory>
-#include "Vehicle.h"
-
-enum class VehicleType {
-    ALPHA_TYPE,
-    BETA_TYPE,
-    CHARLIE_TYPE,
-    DELTA_TYPE,
-    ECHO_TYPE,
-    NUM_OF_VEHICLE_TYPES
-};
-
-class VehicleFactory {
-    public:
-        std::shared_ptr<Vehicle> createVehicle(VehicleType vehicle) const;
-};
-
-#endif /* VEHICLE_FACTORY_H */
+/**
+ * @file VehicleFactory.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2022-05-11
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+#ifndef VEHICLE_FACTORY_H
+#define VEHICLE_FACTORY_H
+
+#include <memory>
+#include <vector>
+#include "Vehicle.h"
+#include "VehicleArena.h"
+#include "VehicleRegistry.h"
+#include "Philox.h"
+#include "ThreadPool.h"
+
+// Streams with this bit set pick fleet mixes, so they never overlap the
+// fault streams of a simulation run under the same seed
+constexpr uint64_t FLEET_STREAM = 1ULL << 63;
+
+// Relative share of each vehicle type in a fleet, indexed by vehicle type.
+// Types past the end get no share; an empty mix is an even mix.
+using FleetMix = std::vector<double>;
+
+class VehicleFactory {
+    private:
+        const VehicleRegistry &_registry;
+    public:
+        explicit VehicleFactory(const VehicleRegistry &registry);
+        std::shared_ptr<Vehicle> createVehicle(VehicleType vehicleType) const;
+        std::vector<std::shared_ptr<Vehicle>> createFleet(const FleetMix &mix, size_t count, uint64_t seed, uint64_t stream = FLEET_STREAM, ThreadPool *pool = nullptr) const;
+};
+
+#endif /* VEHICLE_FACTORY_H */
@@ -0,0 +1,29 @@
+/**
+ * @file VehicleRegistry.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef VEHICLE_REGISTRY_H
+#define VEHICLE_REGISTRY_H
+
+#include "VehicleSpec.h"
+#include <string>
+#include <vector>
+
+// Flat table of vehicle specs indexed by type. Vehicles point into the table,
+// so specs must all be added before any vehicle is created.
+class VehicleRegistry {
+    private:
+        std::vector<VehicleSpec> _specs;
+    public:
+        bool loadCsv(const std::string &path);
+        VehicleType addSpec(VehicleSpec spec);
+        size_t size() const;
+        const VehicleSpec &operator[](VehicleType type) const;
+};
+
+#endif /* VEHICLE_REGISTRY_H */
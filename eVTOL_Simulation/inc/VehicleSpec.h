@@ -0,0 +1,42 @@
+/**
+ * @file VehicleSpec.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+#ifndef VEHICLE_SPEC_H
+#define VEHICLE_SPEC_H
+
+#include "ChargeCurve.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// Index of a vehicle type in the VehicleRegistry
+using VehicleType = size_t;
+
+// Parameters of one company vehicle type
+struct VehicleSpec {
+
+    // Read from the vehicle config file
+    std::string name;
+    int cruiseSpeedMph = 0;
+    int batteryCapacityKwh = 0;
+    double timeToChargeHr = 0.0;
+    double energyUsePerMiKwh = 0.0;
+    int passengerCount = 0;
+    double faultProbability = 0.0;
+    double chargeTaperSoc = 100.0;      // Optional, 100 charges linearly
+
+    // Filled in by the registry when the spec is added
+    VehicleType type = 0;
+    double energyUseKwh = 0.0;          // Energy used per ms of cruise
+    double faultRate = 0.0;             // Expected faults per simulated ms
+    double fullChargeMs = 0.0;          // Time to charge from empty
+    std::shared_ptr<const ChargeCurve> chargeCurve; // Null when linear
+};
+
+#endif /* VEHICLE_SPEC_H */
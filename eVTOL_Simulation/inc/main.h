@@ -1,31 +1,53 @@
-/**
- * @file main.h
- * @author Adrian Deardorff (80deardorff@gmail.com)
- * @version 0.1
- * @date 2022-05-11
- * 
- * @copyright Copyright (c) 2022
- * 
- */
-#ifndef MAIN_H
-#define MAIN_H
-
-// Simulation configurations - modify as necessary
-#define NUM_OF_TEST_VEHICLES    20UL    // Number of test vehicles
-#define NUM_OF_CHARGERS         3UL     // Number of available chargers
-#define TEST_LENGTH_MIN         3UL     // Length of simulation in minutes
-#define TIME_SCALE_FACTOR       60UL    // Scales the sim to real time 1min=1hr
-
-// Utility defines
-#define MS_TO_HR(ms)            (((double)ms) / 1000UL / 60UL / 60UL)
-#define MS_TO_SEC(ms)           (((double)ms) / 1000UL)
-#define HR_TO_MS(hr)            ((long)((hr) * 1000UL * 60UL * 60UL))
-#define TEST_LENGTH_MS          (TEST_LENGTH_MIN * (1000UL * 60UL))
-#define SIM_DELAY               10  // In ms; modify if needed for tuning
-#define ENABLE                  1
-#define DISABLE                 0
-
-// Debug mode allows debug code to be ran
-#define DEBUG_MODE              0
-
-#endif /* MAIN_H */
+/**
+ * @file main.h
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2022-05-11
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+#ifndef MAIN_H
+#define MAIN_H
+
+// Default simulation configuration, each can be overridden at run time
+// from the command line or a config file (run with --help)
+#define NUM_OF_TEST_VEHICLES    20UL    // Number of test vehicles
+#define FLEET_MIX               {}      // Share of each vehicle type in config order, {} for even
+#define NUM_OF_DEPOTS           1UL     // Number of charging depots
+#define NUM_OF_CHARGERS         3UL     // Number of available chargers per depot
+#define TEST_LENGTH_MIN         3UL     // Length of simulation in minutes
+#define TIME_SCALE_FACTOR       60UL    // Scales the sim to real time 1min=1hr
+#define EVENT_DRIVEN            1       // Jump between events instead of polling
+#define CLOCK_MODE              ClockMode::FAST // REAL_TIME, SCALED or FAST
+#define CHARGE_QUEUE_POLICY     QueuePolicy::FIFO // FIFO, SHORTEST_CHARGE_FIRST or HIGHEST_PASSENGER_VALUE_FIRST
+#define ORDERED_ARRIVALS        ENABLE  // Sort depot arrivals so threaded runs are reproducible
+#define STEP_THREADS            1UL     // Threads stepping the polling loop, 0 for all cores
+#define FIXED_KERNELS           DISABLE // Step with kernels compiled for the types in ProductionFleet.h
+#define BATCH_REPLICAS          0UL     // Monte Carlo replicas across all cores, 0 for one run
+#define VEHICLE_CONFIG_FILE     "config/vehicles.csv" // Vehicle specs, relative to the run directory
+#define TELEMETRY_FILE          ""      // Fleet metrics over time, "" for none
+#define TELEMETRY_FORMAT        TelemetryFormat::BINARY // BINARY (columnar chunks) or CSV
+#define TELEMETRY_PERIOD_MS     60000.0 // Simulated ms between telemetry samples
+
+// Utility defines
+#define MS_TO_HR(ms)            (((double)ms) / 1000UL / 60UL / 60UL)
+#define MS_TO_SEC(ms)           (((double)ms) / 1000UL)
+#define HR_TO_MS(hr)            ((long)((hr) * 1000UL * 60UL * 60UL))
+#define TEST_LENGTH_MS          (TEST_LENGTH_MIN * (1000UL * 60UL))
+#define SIM_LENGTH_MS           (TEST_LENGTH_MS * TIME_SCALE_FACTOR)
+#define SIM_DELAY               10  // In ms; modify if needed for tuning
+#define SIM_STEP_MS             (SIM_DELAY * TIME_SCALE_FACTOR) // Simulated ms per loop
+#define ENABLE                  1
+#define DISABLE                 0
+
+// Debug mode allows debug code to be ran
+#define DEBUG_MODE              0
+
+// Trace mode records hot path timers and counters for --trace (build with
+// make DEFINES=-DTRACE_MODE=1); when off they compile to nothing
+#ifndef TRACE_MODE
+#define TRACE_MODE              0
+#endif /* TRACE_MODE */
+
+#endif /* MAIN_H */
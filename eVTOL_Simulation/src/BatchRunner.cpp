@@ -0,0 +1,180 @@
+/**
+ * @file BatchRunner.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "main.h"
+#include "BatchRunner.h"
+#include "DepotNetwork.h"
+#include "SimClock.h"
+#include "Simulation.h"
+#include "ThreadPool.h"
+#include "Trace.h"
+#include "VehicleFactory.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+// Helper function prototypes
+static void printMetric(const std::string &label, const SampleStats &metric);
+
+/**
+ * @brief Construct a new Batch Runner:: Batch Runner object
+ * 
+ * @param registry Specs of every vehicle type
+ * @param config Settings every replica runs with; threads of 0 runs one
+ * worker per core
+ */
+BatchRunner::BatchRunner(const VehicleRegistry &registry, const SimulationConfig &config)
+    : _registry{registry}
+    , _config{config} {}
+
+/**
+ * @brief Runs the replicas and summarizes their results per vehicle type
+ * 
+ * Replica results are stored by replica number and summarized in that
+ * order, so the summary for a given seed does not depend on the number of
+ * threads or how the work was stolen between them.
+ * 
+ * @param replicas Number of independent simulations to run
+ * @param seed Seed of the whole batch; replica streams are derived from it
+ */
+void BatchRunner::run(size_t replicas, uint64_t seed) {
+    _replicas = replicas;
+    _seed = seed;
+
+    // Only the per-type totals of a replica outlive its task, so memory
+    // stays bounded by the replicas in flight rather than the whole batch
+    std::vector<std::vector<TypeStats>> results(replicas);
+    {
+        ThreadPool pool(_config.threads ? _config.threads : std::thread::hardware_concurrency());
+        for(size_t i = 0; i < replicas; i++) {
+            pool.submit([this, &results, i] { results[i] = runReplica(i); });
+        }
+        pool.wait();
+    }
+
+    _summary.assign(_registry.size(), TypeSummary{});
+    for(size_t type = 0; type < _registry.size(); type++) {
+        _summary[type].name = _registry[type].name;
+    }
+
+    for(const auto &types : results) {
+        for(size_t type = 0; type < types.size(); type++) {
+            const auto &totals = types[type];
+            auto &summary = _summary[type];
+            summary.vehicleCount.add(totals.vehicleCount);
+            if(totals.vehicleCount == 0) continue;
+
+            double perVehicle = 1.0 / totals.vehicleCount;
+            summary.timeInFlightHr.add(totals.timeInFlightHr * perVehicle);
+            summary.timeChargingHr.add(totals.timeChargingHr * perVehicle);
+            summary.timeAwaitingChargeHr.add(totals.timeAwaitingChargeHr * perVehicle);
+            summary.faultCount.add(totals.faultCount * perVehicle);
+            summary.distanceAllPassengersMi.add(totals.distanceAllPassengersMi * perVehicle);
+        }
+    }
+}
+
+/**
+ * @brief Gets the summary of the last batch, indexed by vehicle type
+ * 
+ * @return const std::vector<TypeSummary>&
+ */
+const std::vector<TypeSummary> &BatchRunner::getSummary() const {
+    return _summary;
+}
+
+/**
+ * @brief Prints the summary of the last batch to the terminal
+ * 
+ */
+void BatchRunner::printSummary() const {
+    std::cout << "Monte Carlo Results for " << _replicas << " replicas of " <<
+        _config.hours << " HR (seed " << _seed << ")\n" <<
+        "mean +/- 95% confidence [variance], per vehicle" << std::endl;
+
+    for(const auto &summary : _summary) {
+        std::cout << "\n***" << summary.name << " Vehicle Stats***\n";
+        printMetric("Vehicle Count:  ", summary.vehicleCount);
+        printMetric("Time Flying:    ", summary.timeInFlightHr);
+        printMetric("Time Charging:  ", summary.timeChargingHr);
+        printMetric("Time Waiting:   ", summary.timeAwaitingChargeHr);
+        printMetric("Faults:         ", summary.faultCount);
+        printMetric("Total Distance: ", summary.distanceAllPassengersMi);
+    }
+}
+
+/**
+ * @brief Prints the summary of the last batch as CSV, one row per vehicle
+ * type and metric
+ * 
+ */
+void BatchRunner::printSummaryCsv() const {
+    std::cout << "company,metric,mean,ci95,variance\n";
+    for(const auto &summary : _summary) {
+        const std::pair<const char *, const SampleStats *> metrics[] = {
+            {"vehicle_count", &summary.vehicleCount},
+            {"flight_hr", &summary.timeInFlightHr},
+            {"charging_hr", &summary.timeChargingHr},
+            {"waiting_hr", &summary.timeAwaitingChargeHr},
+            {"faults", &summary.faultCount},
+            {"passenger_mi", &summary.distanceAllPassengersMi}};
+        for(const auto &metric : metrics) {
+            std::cout << summary.name << "," << metric.first << "," <<
+                metric.second->getMean() << "," << metric.second->getConfidence95() << "," <<
+                metric.second->getVariance() << "\n";
+        }
+    }
+    std::cout << std::flush;
+}
+
+/*******************Private Member Methods***********************/
+/**
+ * @brief Runs one replica on its own fleet, clock and random stream
+ * 
+ * @param replica Replica number, used as the random stream under the batch seed
+ * @return std::vector<TypeStats> Totals of the replica per vehicle type
+ */
+std::vector<TypeStats> BatchRunner::runReplica(size_t replica) const {
+    TRACE_SCOPE("replica");
+
+    // Independent, reproducible streams for every replica of the batch
+    VehicleFactory factory(_registry);
+    auto vehicles = factory.createFleet(_config.mix, _config.vehicles, _seed, FLEET_STREAM | replica);
+
+    DepotNetwork depots(_config.depots, _config.chargers, _config.policy, _config.orderedArrivals);
+
+    // Replicas never pace themselves against the wall clock
+    FastClock clock;
+    Simulation sim(clock, _registry, _seed, replica);
+    sim.setShowProgress(false);
+    sim.setStepMs(_config.stepMs);
+    if(_config.fixedKernels) sim.setKernels(&_fixedKernels);
+    if(_config.eventDriven) {
+        sim.startEventSimulation(vehicles, depots, _config.getLengthMs());
+    } else {
+        sim.startSimulation(vehicles, depots, _config.getLengthMs());
+    }
+
+    // Per-vehicle stats are dropped with the simulation
+    const auto &stats = sim.getStats();
+    std::vector<TypeStats> totals(stats.getTypeCount());
+    for(size_t type = 0; type < totals.size(); type++) {
+        totals[type] = stats.getTypeStats(type);
+    }
+    return totals;
+}
+
+/*******************Private Helper Functions***********************/
+static void printMetric(const std::string &label, const SampleStats &metric) {
+    std::cout << label << std::fixed << std::setprecision(4) << metric.getMean() <<
+        " +/- " << metric.getConfidence95() <<
+        " [" << metric.getVariance() << "]\n" << std::defaultfloat;
+}
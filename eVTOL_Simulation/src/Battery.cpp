@@ -1,159 +1,179 @@
-/**
- * @file Battery.cpp
- * @author Adrian Deardorff (80deardorff@gmail.com)
- * @version 0.1
- * @date 2022-05-11
- * 
- * @copyright Copyright (c) 2022
- * 
- */
-
-#include "main.h"
-#include "Battery.h"
-#include <thread>
-#include <chrono>
-#include <iostream>
-
-/**
- * @brief Construct a new Battery:: Battery object
- * 
- * @param capacityKwh Battery capacity parameter for Battery object
- * @param energyUseKwh Energy usage parameter per millisecond of travel for Battery object
- * @param timeToChargeHr Battery time to charge parameter for Battery object
- */
-Battery::Battery(int capacityKwh, double energyUse, double timeToChargeHr)
-    : _capacityKwh{capacityKwh}
-    , _currChargeKwh{(double)capacityKwh}
-    , _energyUseKwh{energyUse}
-    , _timeToChargeHr{timeToChargeHr} {}
-
-/**
- * @brief Get the capacity of the battery object
- * 
- * @return int Max capacity of the battery in kWh
- */
-int Battery::getCapacity() const {
-    return _capacityKwh;
-}
-
-/**
- * @brief Gets the current state of charge of the battery object
- * 
- * @return double State of charge from 0.0 to 100.0
- */
-double Battery::getStateOfCharge() const {
-    return _stateOfCharge;
-}
-
-/**
- * @brief Get the energy use of the vehicle
- * 
- * @return double Energy use in kWh per millisecond of travel at cruise speed
- */
-double Battery::getEnergyUse() const {
- return _energyUseKwh;
-}
-
-/**
- * @brief Gets the charge time of the battery object
- * 
- * @return double Charge time from 0% to 100% capacity in hours
- */
-double Battery::getTimeToChargeHr() const {
-    return _timeToChargeHr;
-}
-
-/**
- * @brief Starts the draining of the battery until empty
- * 
- */
-void Battery::drainBattery(long ms) {
-    double amount = _energyUseKwh * ms * TIME_SCALE_FACTOR;
-
-    // Checks for negative; otherwise subtracts amount calculated for time given
-    _currChargeKwh = (_currChargeKwh - amount < 0.0) ? 
-        0.0 :
-        _currChargeKwh - amount;
-    this->setStateOfCharge();
-}
-
-/**
- * @brief Starts the charging of the battery until full
- * 
- */
-void Battery::chargeBattery() {
-    // Check if vehicle is already charging or it is 100% soc
-    if(isCharging() || _stateOfCharge == 100.0) return;
-    
-    // Set the charging state
-    setCharging(ENABLE);
-
-    // Create and run thread for charging
-    std::thread t([this]() {
-
-        // Get rate of charger for current battery pack
-        double rate = (double)getCapacity() / HR_TO_MS(getTimeToChargeHr()) * TIME_SCALE_FACTOR * SIM_DELAY;
-
-        // This sets an awake point for the next iteration of while loop. If the
-        // simulation starts to lag behind, it will catch up and keep timing
-        // calculations accurate.
-        auto awakeTime = std::chrono::steady_clock::now();
-
-        // Run loop and charge the battery based on rate until full
-        while(getStateOfCharge() < 100.0) {
-            
-            // Set awake time of next loop
-            awakeTime += std::chrono::milliseconds(SIM_DELAY);
-
-            // Increase charge per rate (taking into account the loop wait period)
-            _currChargeKwh += rate;
-
-            // Update state of charge
-            setStateOfCharge();
-
-            // Not a busy sleep, will yield to other threads
-            std::this_thread::sleep_until(awakeTime);
-        }
-
-        // Set charge state as not charging
-        setCharging(DISABLE);
-    });
-
-    // Detach the thread to run in the background on its own
-    // TODO as improvement later would be to use jthread in C++20 instead of
-    // detaching. This way, we can ensure the thread operates correctly in the
-    // background. 
-    t.detach();
-}
-
-/**
- * @brief Check for if vehicle is charging
- * 
- * @return true 
- * @return false 
- */
-bool Battery::isCharging() const {
-    return _charging;
-}
-
-/**
- * @brief Sets the state of charging for the battery
- * 
- * @param EnOrDi @main.h for macro ENABLE or DISABLE
- */
-void Battery::setCharging(int EnOrDi) {
-    if(EnOrDi && _stateOfCharge < 100.0) _charging = true;
-    else _charging = false;
-}
-
-/*******************Private Member Methods***********************/
-/**
- * @brief Set the state of charge for the battery object
- * 
- */
-void Battery::setStateOfCharge() {
-    double currentState = _currChargeKwh / _capacityKwh * 100.0;
-    if(currentState > 100.0) _stateOfCharge = 100.0;
-    else if(currentState < 0) _stateOfCharge = 0.0;
-    else _stateOfCharge = currentState;
-}
+/**
+ * @file Battery.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2022-05-11
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "main.h"
+#include "Battery.h"
+
+/**
+ * @brief Construct a new Battery:: Battery object, full and idle
+ * 
+ * @param capacityKwh Battery capacity parameter for Battery object
+ * @param energyUseKwh Energy usage parameter per millisecond of travel for Battery object
+ * @param timeToChargeHr Battery time to charge parameter for Battery object
+ * @param curve Charge curve of the vehicle type, must outlive the battery;
+ * nullptr to charge at the rated rate all the way to full
+ */
+Battery::Battery(int capacityKwh, double energyUse, double timeToChargeHr, const ChargeCurve *curve)
+    : _capacityKwh{capacityKwh}
+    , _energyUseKwh{energyUse}
+    , _timeToChargeHr{timeToChargeHr}
+    , _chargeRateKwh{(double)capacityKwh / HR_TO_MS(timeToChargeHr)}
+    , _curve{curve}
+    , _chargeKwh{(double)capacityKwh} {}
+
+/**
+ * @brief Get the capacity of the battery object
+ * 
+ * @return int Max capacity of the battery in kWh
+ */
+int Battery::getCapacity() const {
+    return _capacityKwh;
+}
+
+/**
+ * @brief Gets the energy left in the battery object at the given time
+ * 
+ * @param nowMs Simulated time, no earlier than the last mode change
+ * @return double Charge in kWh
+ */
+double Battery::getCharge(double nowMs) const {
+    double elapsed = nowMs - _sinceMs;
+    switch(_mode) {
+        case BatteryMode::DRAINING: {
+            double charge = _chargeKwh - _energyUseKwh * elapsed;
+            return (charge < 0.0) ? 0.0 : charge;
+        }
+        case BatteryMode::CHARGING: {
+            if(_curve) return _curve->getChargeAt(_curveMs + elapsed);
+            double charge = _chargeKwh + _chargeRateKwh * elapsed;
+            return (charge > _capacityKwh) ? _capacityKwh : charge;
+        }
+        case BatteryMode::IDLE:
+        default:
+            return _chargeKwh;
+    }
+}
+
+/**
+ * @brief Gets the state of charge of the battery object at the given time
+ * 
+ * @param nowMs Simulated time, no earlier than the last mode change
+ * @return double State of charge from 0.0 to 100.0
+ */
+double Battery::getStateOfCharge(double nowMs) const {
+    return getCharge(nowMs) / _capacityKwh * 100.0;
+}
+
+/**
+ * @brief Get the energy use of the vehicle
+ * 
+ * @return double Energy use in kWh per millisecond of travel at cruise speed
+ */
+double Battery::getEnergyUse() const {
+ return _energyUseKwh;
+}
+
+/**
+ * @brief Gets the charge time of the battery object
+ * 
+ * @return double Charge time from 0% to 100% capacity in hours
+ */
+double Battery::getTimeToChargeHr() const {
+    return _timeToChargeHr;
+}
+
+/**
+ * @brief Get the rate the charger fills the battery pack, before any taper
+ * 
+ * @return double Charge rate in kWh per millisecond
+ */
+double Battery::getChargeRate() const {
+    return _chargeRateKwh;
+}
+
+/**
+ * @brief Gets the exact time from the given time until the battery would be
+ * empty flying at cruise
+ * 
+ * @param nowMs Simulated time, no earlier than the last mode change
+ * @return double Time in milliseconds until 0% soc
+ */
+double Battery::getTimeToEmpty(double nowMs) const {
+    return getCharge(nowMs) / _energyUseKwh;
+}
+
+/**
+ * @brief Gets the exact time from the given time until the battery would be
+ * full on a charger
+ * 
+ * @param nowMs Simulated time, no earlier than the last mode change
+ * @return double Time in milliseconds until 100% soc
+ */
+double Battery::getTimeToFull(double nowMs) const {
+    if(_curve) {
+        double curveMs = (_mode == BatteryMode::CHARGING) ? _curveMs + nowMs - _sinceMs : _curve->getMsAt(getCharge(nowMs));
+        return (curveMs < _curve->getFullMs()) ? _curve->getFullMs() - curveMs : 0.0;
+    }
+    return (_capacityKwh - getCharge(nowMs)) / _chargeRateKwh;
+}
+
+/**
+ * @brief Gets whether the battery is draining, charging or idle
+ * 
+ * @return BatteryMode
+ */
+BatteryMode Battery::getMode() const {
+    return _mode;
+}
+
+/**
+ * @brief Settles the charge reached so far and switches to a new mode
+ * 
+ * @param mode Draining at cruise, charging or idle from now on
+ * @param nowMs Simulated time of the change, no earlier than the last one.
+ * An idle battery can be restarted at any time, e.g. 0 for a new run.
+ */
+void Battery::setMode(BatteryMode mode, double nowMs) {
+    _chargeKwh = getCharge(nowMs);
+    _sinceMs = nowMs;
+    _mode = (mode == BatteryMode::CHARGING && _chargeKwh >= _capacityKwh) ? BatteryMode::IDLE : mode;
+    if(_curve && _mode == BatteryMode::CHARGING) _curveMs = _curve->getMsAt(_chargeKwh);
+}
+
+/**
+ * @brief Gets the charge and mode as of the last mode change
+ * 
+ * @return BatteryState
+ */
+BatteryState Battery::getState() const {
+    return BatteryState{_chargeKwh, _sinceMs, _mode};
+}
+
+/**
+ * @brief Puts the battery back in a state saved by getState
+ * 
+ * @param state Saved state
+ */
+void Battery::setState(const BatteryState &state) {
+    _chargeKwh = state.chargeKwh;
+    _sinceMs = state.sinceMs;
+    _mode = state.mode;
+    if(_curve && _mode == BatteryMode::CHARGING) _curveMs = _curve->getMsAt(_chargeKwh);
+}
+
+/**
+ * @brief Check for if vehicle is charging
+ * 
+ * @return true 
+ * @return false 
+ */
+bool Battery::isCharging() const {
+    return _mode == BatteryMode::CHARGING;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file ChargeCurve.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "ChargeCurve.h"
+#include <algorithm>
+
+// Midpoint samples of the rate per table interval when integrating a curve
+constexpr size_t CHARGE_CURVE_SUBSTEPS = 16;
+
+// Helper function prototypes
+static double interpolate(const std::vector<double> &table, double position);
+
+/**
+ * @brief Integrates a charge curve into its lookup tables
+ * 
+ * @param capacityKwh Capacity of the battery
+ * @param ratedKwhPerMs Rate of the charger at full power
+ * @param relativeRate Share of the rated rate at a state of charge, both
+ * from 0.0 to 1.0; must stay above 0
+ */
+ChargeCurve::ChargeCurve(double capacityKwh, double ratedKwhPerMs, const std::function<double(double)> &relativeRate)
+    : _capacityKwh{capacityKwh}
+    , _msAtCharge(CHARGE_CURVE_POINTS + 1, 0.0)
+    , _chargeAtMs(CHARGE_CURVE_POINTS + 1, 0.0) {
+
+    // Time to cross each interval of charge is the sum of dCharge / rate
+    double cellKwh = capacityKwh / CHARGE_CURVE_POINTS;
+    double stepKwh = cellKwh / CHARGE_CURVE_SUBSTEPS;
+    for(size_t i = 0; i < CHARGE_CURVE_POINTS; i++) {
+        double ms = 0.0;
+        for(size_t s = 0; s < CHARGE_CURVE_SUBSTEPS; s++) {
+            double soc = (i * cellKwh + (s + 0.5) * stepKwh) / capacityKwh;
+            ms += stepKwh / (ratedKwhPerMs * relativeRate(soc));
+        }
+        _msAtCharge[i + 1] = _msAtCharge[i] + ms;
+    }
+    _fullMs = _msAtCharge[CHARGE_CURVE_POINTS];
+
+    // Invert the table at evenly spaced times; both tables are increasing
+    size_t cell = 0;
+    for(size_t j = 0; j <= CHARGE_CURVE_POINTS; j++) {
+        double ms = _fullMs * j / CHARGE_CURVE_POINTS;
+        while(cell < CHARGE_CURVE_POINTS - 1 && _msAtCharge[cell + 1] < ms) cell++;
+        double frac = (ms - _msAtCharge[cell]) / (_msAtCharge[cell + 1] - _msAtCharge[cell]);
+        _chargeAtMs[j] = (cell + std::min(std::max(frac, 0.0), 1.0)) * cellKwh;
+    }
+    _chargeAtMs[CHARGE_CURVE_POINTS] = capacityKwh;
+}
+
+/**
+ * @brief Creates a constant current, constant voltage curve: the rated rate
+ * up to the taper point, then a rate falling linearly to CC_CV_END_RATE of
+ * it at full
+ * 
+ * @param capacityKwh Capacity of the battery
+ * @param ratedKwhPerMs Rate of the charger in the constant current phase
+ * @param taperSoc State of charge the taper starts at, from 0.0 to 1.0
+ * @return std::shared_ptr<const ChargeCurve>
+ */
+std::shared_ptr<const ChargeCurve> ChargeCurve::createCcCv(double capacityKwh, double ratedKwhPerMs, double taperSoc) {
+    return std::make_shared<const ChargeCurve>(capacityKwh, ratedKwhPerMs, [taperSoc](double soc) {
+        if(soc <= taperSoc) return 1.0;
+        return 1.0 - (1.0 - CC_CV_END_RATE) * (soc - taperSoc) / (1.0 - taperSoc);
+    });
+}
+
+/**
+ * @brief Gets the time to charge from empty to full
+ * 
+ * @return double Time in milliseconds
+ */
+double ChargeCurve::getFullMs() const {
+    return _fullMs;
+}
+
+/**
+ * @brief Gets the time on the curve at which the battery holds a charge
+ * 
+ * @param chargeKwh Charge, clamped to the capacity
+ * @return double Time in milliseconds from empty
+ */
+double ChargeCurve::getMsAt(double chargeKwh) const {
+    return interpolate(_msAtCharge, chargeKwh / _capacityKwh * CHARGE_CURVE_POINTS);
+}
+
+/**
+ * @brief Gets the charge at a time on the curve
+ * 
+ * @param ms Time in milliseconds from empty, clamped to the full time
+ * @return double Charge in kWh
+ */
+double ChargeCurve::getChargeAt(double ms) const {
+    return interpolate(_chargeAtMs, ms / _fullMs * CHARGE_CURVE_POINTS);
+}
+
+/*******************Private Helper Functions***********************/
+static double interpolate(const std::vector<double> &table, double position) {
+    if(position <= 0.0) return table.front();
+    if(position >= CHARGE_CURVE_POINTS) return table.back();
+    size_t i = (size_t)position;
+    double frac = position - i;
+    return table[i] + (table[i + 1] - table[i]) * frac;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file ChargeQueue.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "ChargeQueue.h"
+#include "Charger.h"
+#include <algorithm>
+
+/**
+ * @brief Orders the entry to serve next to the top of the heap
+ * 
+ * @return true if a is served after b
+ */
+bool ChargeQueue::Later::operator()(const Entry &a, const Entry &b) const {
+    if(a.priority != b.priority) return a.priority > b.priority;
+    return a.sequence > b.sequence;
+}
+
+/**
+ * @brief Removes every vehicle from the queue
+ * 
+ */
+void ChargeQueue::clear() {
+    _heap.clear();
+    _nextSequence = 0;
+}
+
+/**
+ * @brief Queues the vehicle into the line of vehicles waiting to charge
+ * 
+ * @param vehicle Index of the vehicle in the fleet
+ * @param priority Lower values are served first, ties in arrival order
+ */
+void ChargeQueue::enqueueVehicleWaiting(size_t vehicle, double priority) {
+    if(vehicle != NO_VEHICLE) {
+        _heap.push_back({priority, _nextSequence++, vehicle});
+        std::push_heap(_heap.begin(), _heap.end(), Later{});
+    }
+}
+
+/**
+ * @brief Removes the vehicle with the best priority from the line
+ * 
+ * @return size_t Index of the vehicle in the fleet
+ */
+size_t ChargeQueue::dequeueVehicleWaiting() {
+    std::pop_heap(_heap.begin(), _heap.end(), Later{});
+    auto vehicle = _heap.back().vehicle;
+    _heap.pop_back();
+    return vehicle;
+}
+
+/**
+ * @brief Checks if the charge queue is empty
+ * 
+ * @return true 
+ * @return false 
+ */
+bool ChargeQueue::isEmpty() const {
+    return _heap.empty();
+}
+
+/**
+ * @brief Gets the number of vehicles waiting to charge
+ * 
+ * @return size_t 
+ */
+size_t ChargeQueue::size() const {
+    return _heap.size();
+}
+
+/**
+ * @brief Adds waiting time to every vehicle in the charge queue
+ * 
+ * @param fleet Fleet the queued indices belong to
+ * @param ms Time in milliseconds to add
+ */
+void ChargeQueue::increaseTimeWaiting(FleetState &fleet, double ms) const {
+    for(const auto &entry : _heap) {
+        fleet.addTimeAwaitingCharge(entry.vehicle, ms);
+    }
+}
+
+/**
+ * @brief Gets the vehicles in the queue in heap order
+ * 
+ * @return const std::vector<Entry>&
+ */
+const std::vector<ChargeQueue::Entry> &ChargeQueue::getEntries() const {
+    return _heap;
+}
+
+/**
+ * @brief Gets the sequence number the next queued vehicle will get
+ * 
+ * @return unsigned long
+ */
+unsigned long ChargeQueue::getNextSequence() const {
+    return _nextSequence;
+}
+
+/**
+ * @brief Replaces the queue with saved entries
+ * 
+ * @param entries Entries from getEntries, still in heap order
+ * @param nextSequence Sequence number from getNextSequence
+ */
+void ChargeQueue::restore(const std::vector<Entry> &entries, unsigned long nextSequence) {
+    _heap = entries;
+    std::make_heap(_heap.begin(), _heap.end(), Later{});
+    _nextSequence = nextSequence;
+}
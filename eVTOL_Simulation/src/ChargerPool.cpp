@@ -0,0 +1,211 @@
+/**
+ * @file ChargerPool.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "ChargerPool.h"
+#include "Trace.h"
+
+/**
+ * @brief Construct a new Charger Pool:: Charger Pool object
+ * 
+ * @param count Number of chargers
+ * @param policy Order the charge queue is served in
+ */
+ChargerPool::ChargerPool(size_t count, QueuePolicy policy)
+    : _chargers(count)
+    , _policy{policy} {
+    reset();
+}
+
+/**
+ * @brief Frees every charger and empties the queue for a new run
+ * 
+ */
+void ChargerPool::reset() {
+    _idle.clear();
+
+    // Pushed in reverse so the lowest numbered charger is handed out first
+    for(size_t i = _chargers.size(); i > 0; i--) {
+        _chargers[i - 1].setVehicleCharging(NO_VEHICLE);
+        _idle.push_back(i - 1);
+    }
+    _chargerOf.clear();
+    _queue.clear();
+}
+
+/**
+ * @brief Gets the number of chargers
+ * 
+ * @return size_t 
+ */
+size_t ChargerPool::size() const {
+    return _chargers.size();
+}
+
+/**
+ * @brief Gets the number of chargers with no vehicle on them
+ * 
+ * @return size_t 
+ */
+size_t ChargerPool::getIdleCount() const {
+    return _idle.size();
+}
+
+/**
+ * @brief Gets the order the charge queue is served in
+ * 
+ * @return QueuePolicy 
+ */
+QueuePolicy ChargerPool::getPolicy() const {
+    return _policy;
+}
+
+/**
+ * @brief Gets a charger
+ * 
+ * @param charger Index of the charger
+ * @return const Charger& 
+ */
+const Charger &ChargerPool::operator[](size_t charger) const {
+    return _chargers[charger];
+}
+
+/**
+ * @brief Gets the line of vehicles waiting to charge
+ * 
+ * @return const ChargeQueue& 
+ */
+const ChargeQueue &ChargerPool::getQueue() const {
+    return _queue;
+}
+
+/**
+ * @brief Queues a vehicle with the priority the policy gives its type
+ * 
+ * @param vehicle Index of the vehicle in the fleet
+ * @param spec Spec of the vehicle type
+ */
+void ChargerPool::enqueueVehicleWaiting(size_t vehicle, const VehicleSpec &spec) {
+    _queue.enqueueVehicleWaiting(vehicle, getPriority(spec));
+}
+
+/**
+ * @brief Checks if a vehicle is waiting and a charger is free
+ * 
+ * @return true 
+ * @return false 
+ */
+bool ChargerPool::canAdmit() const {
+    return !_idle.empty() && !_queue.isEmpty();
+}
+
+/**
+ * @brief Puts the next vehicle in line on an idle charger
+ * 
+ * Only call when canAdmit() is true.
+ * 
+ * @param charger Set to the index of the charger used
+ * @return size_t Index of the vehicle admitted
+ */
+size_t ChargerPool::admitNext(size_t &charger) {
+    charger = _idle.back();
+    _idle.pop_back();
+
+    size_t vehicle = _queue.dequeueVehicleWaiting();
+    _chargers[charger].setVehicleCharging(vehicle);
+    if(vehicle >= _chargerOf.size()) _chargerOf.resize(vehicle + 1, NO_VEHICLE);
+    _chargerOf[vehicle] = charger;
+    return vehicle;
+}
+
+/**
+ * @brief Gets the charger a vehicle is on
+ * 
+ * @param vehicle Index of the vehicle in the fleet
+ * @return size_t Index of the charger, or NO_VEHICLE if it is not charging
+ */
+size_t ChargerPool::getChargerOf(size_t vehicle) const {
+    return (vehicle < _chargerOf.size()) ? _chargerOf[vehicle] : NO_VEHICLE;
+}
+
+/**
+ * @brief Takes the vehicle off a charger and returns it to the free list
+ * 
+ * @param charger Index of the charger
+ */
+void ChargerPool::release(size_t charger) {
+    size_t vehicle = _chargers[charger].getVehicleCharging();
+    if(vehicle == NO_VEHICLE) return;
+
+    _chargerOf[vehicle] = NO_VEHICLE;
+    _chargers[charger].setVehicleCharging(NO_VEHICLE);
+    _idle.push_back(charger);
+}
+
+/**
+ * @brief Adds waiting time to every vehicle in the charge queue
+ * 
+ * @param fleet Fleet the queued indices belong to
+ * @param ms Time in milliseconds to add
+ */
+void ChargerPool::increaseTimeWaiting(FleetState &fleet, double ms) const {
+    TRACE_SCOPE("increaseTimeWaiting");
+    _queue.increaseTimeWaiting(fleet, ms);
+}
+
+/**
+ * @brief Gets the idle chargers, the next one to be handed out last
+ * 
+ * @return const std::vector<size_t>&
+ */
+const std::vector<size_t> &ChargerPool::getIdle() const {
+    return _idle;
+}
+
+/**
+ * @brief Puts the chargers and queue back in a saved state
+ * 
+ * @param charging Vehicle on each charger, or NO_VEHICLE
+ * @param idle Idle chargers from getIdle
+ * @param queued Queue entries from ChargeQueue::getEntries
+ * @param nextSequence Sequence number from ChargeQueue::getNextSequence
+ */
+void ChargerPool::restore(const std::vector<size_t> &charging, const std::vector<size_t> &idle, const std::vector<ChargeQueue::Entry> &queued, unsigned long nextSequence) {
+    _chargerOf.clear();
+    for(size_t charger = 0; charger < _chargers.size(); charger++) {
+        size_t vehicle = charging[charger];
+        _chargers[charger].setVehicleCharging(vehicle);
+        if(vehicle == NO_VEHICLE) continue;
+        if(vehicle >= _chargerOf.size()) _chargerOf.resize(vehicle + 1, NO_VEHICLE);
+        _chargerOf[vehicle] = charger;
+    }
+    _idle = idle;
+    _queue.restore(queued, nextSequence);
+}
+
+/*******************Private Member Methods***********************/
+/**
+ * @brief Gets the queue priority of a vehicle type, lower is served first
+ * 
+ * @param spec Spec of the vehicle type
+ * @return double 
+ */
+double ChargerPool::getPriority(const VehicleSpec &spec) const {
+    switch(_policy) {
+        case QueuePolicy::SHORTEST_CHARGE_FIRST:
+            // Vehicles queue on an empty battery, so this is the charge time
+            return spec.fullChargeMs;
+        case QueuePolicy::HIGHEST_PASSENGER_VALUE_FIRST:
+            // Passenger miles flown per hour once back in the air
+            return -(double)spec.passengerCount * spec.cruiseSpeedMph;
+        case QueuePolicy::FIFO:
+        default:
+            return 0.0;
+    }
+}
@@ -0,0 +1,184 @@
+/**
+ * @file Checkpoint.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "Checkpoint.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+// Magic number at the start of every checkpoint file
+static const char CHECKPOINT_MAGIC[8] = {'E', 'V', 'T', 'L', 'C', 'K', 'P', '1'};
+
+// Sections in file order
+enum class SectionId : uint32_t {
+    RUN = 1,
+    TYPES,
+    VEHICLES,
+    EVENTS,
+    DEPOTS,
+    CHARGERS,
+    IDLE,
+    QUEUED,
+    COUNT = QUEUED
+};
+
+struct SectionHeader {
+    uint32_t id;
+    uint32_t recordSize;
+    uint64_t offset;
+    uint64_t count;
+};
+
+// Records are plain 64 bit fields, so the layout has no padding to vary
+static_assert(sizeof(Checkpoint::Run) == 11 * 8, "no padding in checkpoint records");
+static_assert(sizeof(Checkpoint::TypeEntry) == 13 * 8, "no padding in checkpoint records");
+static_assert(sizeof(Checkpoint::VehicleEntry) == 12 * 8, "no padding in checkpoint records");
+static_assert(sizeof(Checkpoint::DepotEntry) == 8 * 8, "no padding in checkpoint records");
+static_assert(sizeof(SectionHeader) == 24, "no padding in checkpoint records");
+
+// Helper function prototypes
+static size_t alignUp(size_t offset);
+template <typename T>
+static SectionHeader describe(SectionId id, const std::vector<T> &records, size_t &offset);
+template <typename T>
+static bool readSection(std::ifstream &file, uint64_t fileSize, const SectionHeader &section, SectionId id, std::vector<T> &records);
+
+/**
+ * @brief Writes the checkpoint to a file
+ * 
+ * @param path Path of the file, replaced if it exists
+ * @return true if the file was written
+ */
+bool Checkpoint::write(const std::string &path) const {
+    std::ofstream file(path, std::ios::binary);
+    if(!file) {
+        std::cerr << "Unable to open checkpoint file " << path << std::endl;
+        return false;
+    }
+
+    // Lay the sections out after the header and directory
+    std::vector<Run> runs{run};
+    size_t offset = sizeof(CHECKPOINT_MAGIC) + 2 * sizeof(uint32_t) + (size_t)SectionId::COUNT * sizeof(SectionHeader);
+    SectionHeader sections[] = {
+        describe(SectionId::RUN, runs, offset),
+        describe(SectionId::TYPES, types, offset),
+        describe(SectionId::VEHICLES, vehicles, offset),
+        describe(SectionId::EVENTS, events, offset),
+        describe(SectionId::DEPOTS, depots, offset),
+        describe(SectionId::CHARGERS, chargers, offset),
+        describe(SectionId::IDLE, idle, offset),
+        describe(SectionId::QUEUED, queued, offset),
+    };
+
+    uint32_t version = CHECKPOINT_VERSION;
+    uint32_t count = (uint32_t)SectionId::COUNT;
+    file.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char *>(sections), sizeof(sections));
+
+    // Pad up to each section and write its records in one go
+    auto writeSection = [&](const SectionHeader &section, const void *data) {
+        static const char zeros[CHECKPOINT_ALIGNMENT] = {};
+        file.write(zeros, section.offset - (size_t)file.tellp());
+        file.write(reinterpret_cast<const char *>(data), section.count * section.recordSize);
+    };
+    writeSection(sections[0], runs.data());
+    writeSection(sections[1], types.data());
+    writeSection(sections[2], vehicles.data());
+    writeSection(sections[3], events.data());
+    writeSection(sections[4], depots.data());
+    writeSection(sections[5], chargers.data());
+    writeSection(sections[6], idle.data());
+    writeSection(sections[7], queued.data());
+
+    file.flush();
+    if(!file) {
+        std::cerr << "Error writing checkpoint file " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads a checkpoint written by write
+ * 
+ * @param path Path of the file
+ * @return true if the file is a checkpoint of this version and was read
+ */
+bool Checkpoint::read(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if(!file) {
+        std::cerr << "Unable to open checkpoint file " << path << std::endl;
+        return false;
+    }
+
+    char magic[sizeof(CHECKPOINT_MAGIC)];
+    uint32_t version = 0;
+    uint32_t count = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&version), sizeof(version));
+    file.read(reinterpret_cast<char *>(&count), sizeof(count));
+    if(!file || !std::equal(magic, magic + sizeof(magic), CHECKPOINT_MAGIC)) {
+        std::cerr << path << " is not a checkpoint file" << std::endl;
+        return false;
+    }
+    if(version != CHECKPOINT_VERSION || count != (uint32_t)SectionId::COUNT) {
+        std::cerr << path << " is checkpoint version " << version << ", expected " << CHECKPOINT_VERSION << std::endl;
+        return false;
+    }
+
+    SectionHeader sections[(size_t)SectionId::COUNT];
+    file.read(reinterpret_cast<char *>(sections), sizeof(sections));
+    auto position = file.tellg();
+    file.seekg(0, std::ios::end);
+    uint64_t fileSize = (uint64_t)file.tellg();
+    file.seekg(position);
+    std::vector<Run> runs;
+    bool valid = file
+        && readSection(file, fileSize, sections[0], SectionId::RUN, runs) && runs.size() == 1
+        && readSection(file, fileSize, sections[1], SectionId::TYPES, types)
+        && readSection(file, fileSize, sections[2], SectionId::VEHICLES, vehicles)
+        && readSection(file, fileSize, sections[3], SectionId::EVENTS, events)
+        && readSection(file, fileSize, sections[4], SectionId::DEPOTS, depots)
+        && readSection(file, fileSize, sections[5], SectionId::CHARGERS, chargers)
+        && readSection(file, fileSize, sections[6], SectionId::IDLE, idle)
+        && readSection(file, fileSize, sections[7], SectionId::QUEUED, queued);
+    if(!valid) {
+        std::cerr << path << ": damaged checkpoint file" << std::endl;
+        return false;
+    }
+    run = runs[0];
+    return true;
+}
+
+/*******************Private Helper Functions***********************/
+static size_t alignUp(size_t offset) {
+    return (offset + CHECKPOINT_ALIGNMENT - 1) / CHECKPOINT_ALIGNMENT * CHECKPOINT_ALIGNMENT;
+}
+
+template <typename T>
+static SectionHeader describe(SectionId id, const std::vector<T> &records, size_t &offset) {
+    SectionHeader section{(uint32_t)id, (uint32_t)sizeof(T), alignUp(offset), records.size()};
+    offset = section.offset + records.size() * sizeof(T);
+    return section;
+}
+
+template <typename T>
+static bool readSection(std::ifstream &file, uint64_t fileSize, const SectionHeader &section, SectionId id, std::vector<T> &records) {
+    if(section.id != (uint32_t)id || section.recordSize != sizeof(T)) return false;
+
+    // A damaged count must not size the read past the end of the file
+    if(section.offset > fileSize || section.count > (fileSize - section.offset) / sizeof(T)) return false;
+    records.resize(section.count);
+    file.seekg(section.offset);
+    file.read(reinterpret_cast<char *>(records.data()), section.count * sizeof(T));
+    return (bool)file;
+}
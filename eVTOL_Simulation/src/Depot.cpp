@@ -0,0 +1,96 @@
+/**
+ * @file Depot.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "Depot.h"
+#include <algorithm>
+
+/**
+ * @brief Construct a new Depot:: Depot object
+ * 
+ * @param chargers Number of chargers at the depot
+ * @param policy Order the depot's charge queue is served in
+ * @param orderedArrivals Sort arrivals by vehicle index so the queue order
+ * does not depend on which thread handed a vehicle over first
+ */
+Depot::Depot(size_t chargers, QueuePolicy policy, bool orderedArrivals)
+    : _chargers(chargers, policy)
+    , _orderedArrivals{orderedArrivals} {}
+
+/**
+ * @brief Frees every charger and empties the queues for a new run. Not
+ * thread safe.
+ * 
+ * @param vehicles Number of vehicles routed to the depot, the most that can
+ * be waiting to arrive at once
+ * @param arrivals Size the arrivals queue for them; without it the queue is
+ * kept at its smallest, for runs that never hand vehicles over
+ */
+void Depot::reset(size_t vehicles, bool arrivals) {
+    _chargers.reset();
+    _full.clear();
+    _arrived.clear();
+    _arrivals.reset(arrivals ? vehicles : 0);
+}
+
+/**
+ * @brief Hands a vehicle that ran out of charge to the depot. Lock free and
+ * safe to call from any thread.
+ * 
+ * @param vehicle Index of the vehicle in the fleet
+ * @return true The vehicle was handed over
+ * @return false The arrivals queue is full
+ */
+bool Depot::arrive(size_t vehicle) {
+    return _arrivals.push(vehicle);
+}
+
+/**
+ * @brief Takes every vehicle handed to the depot since the last call
+ * 
+ * @return const std::vector<size_t>& Indices of the arrived vehicles, in
+ * vehicle index order when arrivals are ordered and in hand-off order
+ * otherwise
+ */
+const std::vector<size_t> &Depot::collectArrivals() {
+    _arrived.clear();
+    size_t vehicle;
+    while(_arrivals.pop(vehicle)) {
+        _arrived.push_back(vehicle);
+    }
+    if(_orderedArrivals) std::sort(_arrived.begin(), _arrived.end());
+    return _arrived;
+}
+
+/**
+ * @brief Gets the chargers and charge queue of the depot
+ * 
+ * @return ChargerPool& 
+ */
+ChargerPool &Depot::getChargers() {
+    return _chargers;
+}
+
+/**
+ * @brief Gets the chargers and charge queue of the depot
+ * 
+ * @return const ChargerPool& 
+ */
+const ChargerPool &Depot::getChargers() const {
+    return _chargers;
+}
+
+/**
+ * @brief Gets the vehicles that filled up on the depot's chargers last loop
+ * 
+ * @return std::vector<size_t>& Indices of the vehicles in the fleet
+ */
+std::vector<size_t> &Depot::getFull() {
+    return _full;
+}
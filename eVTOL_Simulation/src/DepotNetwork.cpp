@@ -0,0 +1,98 @@
+/**
+ * @file DepotNetwork.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "DepotNetwork.h"
+
+/**
+ * @brief Construct a new Depot Network:: Depot Network object
+ * 
+ * @param depots Number of depots, at least one
+ * @param chargersPerDepot Number of chargers at every depot
+ * @param policy Order every depot's charge queue is served in
+ * @param orderedArrivals Sort the vehicles arriving at each depot so runs
+ * stay reproducible when the fleet is stepped on several threads
+ */
+DepotNetwork::DepotNetwork(size_t depots, size_t chargersPerDepot, QueuePolicy policy, bool orderedArrivals) {
+    if(depots == 0) depots = 1;
+    _depots.reserve(depots);
+    for(size_t i = 0; i < depots; i++) {
+        _depots.push_back(std::make_unique<Depot>(chargersPerDepot, policy, orderedArrivals));
+    }
+}
+
+/**
+ * @brief Resets every depot and routes the fleet round robin over them
+ * 
+ * @param vehicles Number of vehicles in the fleet
+ * @param arrivals Size each depot's arrivals queue for the vehicles routed
+ * to it, needed only by the polling engine
+ */
+void DepotNetwork::reset(size_t vehicles, bool arrivals) {
+    for(size_t d = 0; d < _depots.size(); d++) {
+        size_t routed = vehicles / _depots.size() + (d < vehicles % _depots.size() ? 1 : 0);
+        _depots[d]->reset(routed, arrivals);
+    }
+    _depotOf.resize(vehicles);
+    for(size_t i = 0; i < vehicles; i++) {
+        _depotOf[i] = i % _depots.size();
+    }
+}
+
+/**
+ * @brief Gets the number of depots
+ * 
+ * @return size_t 
+ */
+size_t DepotNetwork::size() const {
+    return _depots.size();
+}
+
+/**
+ * @brief Gets the number of chargers across every depot
+ * 
+ * @return size_t 
+ */
+size_t DepotNetwork::getChargerCount() const {
+    size_t count = 0;
+    for(const auto &depot : _depots) {
+        count += depot->getChargers().size();
+    }
+    return count;
+}
+
+/**
+ * @brief Gets a depot
+ * 
+ * @param depot Index of the depot
+ * @return Depot& 
+ */
+Depot &DepotNetwork::operator[](size_t depot) {
+    return *_depots[depot];
+}
+
+/**
+ * @brief Gets a depot
+ * 
+ * @param depot Index of the depot
+ * @return const Depot& 
+ */
+const Depot &DepotNetwork::operator[](size_t depot) const {
+    return *_depots[depot];
+}
+
+/**
+ * @brief Gets the depot a vehicle charges at
+ * 
+ * @param vehicle Index of the vehicle in the fleet
+ * @return size_t Index of the depot
+ */
+size_t DepotNetwork::getDepotOf(size_t vehicle) const {
+    return _depotOf[vehicle];
+}
@@ -0,0 +1,110 @@
+/**
+ * @file EventQueue.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "EventQueue.h"
+
+/**
+ * @brief Orders the heap so the earliest event is on top
+ * 
+ * @return true if event a should be processed after event b
+ */
+bool EventQueue::Later::operator()(const Event &a, const Event &b) const {
+    if(a.timeMs != b.timeMs) return a.timeMs > b.timeMs;
+    return a.sequence > b.sequence;
+}
+
+/**
+ * @brief Schedules an event to be processed at the given time
+ * 
+ * @param timeMs Simulation time of the event in milliseconds
+ * @param type Type of event
+ * @param vehicle Index of the vehicle the event applies to
+ * @param charger Index of the charger the event applies to
+ * @param depot Index of the depot the event applies to
+ */
+void EventQueue::schedule(double timeMs, EventType type, size_t vehicle, size_t charger, size_t depot) {
+    _events.push(Event{timeMs, _nextSequence++, type, vehicle, charger, depot});
+}
+
+/**
+ * @brief Removes the earliest event from the queue
+ * 
+ * @return Event
+ */
+Event EventQueue::pop() {
+    Event event = _events.top();
+    _events.pop();
+    return event;
+}
+
+/**
+ * @brief Gets the time of the earliest event in the queue
+ * 
+ * @return double Simulation time in milliseconds
+ */
+double EventQueue::peekTime() const {
+    return _events.top().timeMs;
+}
+
+/**
+ * @brief Checks if there are no events left to process
+ * 
+ * @return true
+ * @return false
+ */
+bool EventQueue::isEmpty() const {
+    return _events.empty();
+}
+
+/**
+ * @brief Gets the number of events waiting to be processed
+ * 
+ * @return size_t
+ */
+size_t EventQueue::size() const {
+    return _events.size();
+}
+
+/**
+ * @brief Gets a copy of the events waiting to be processed
+ * 
+ * @return std::vector<Event> Events in the order they will be processed
+ */
+std::vector<Event> EventQueue::getPending() const {
+    auto queue = _events;
+    std::vector<Event> events;
+    events.reserve(queue.size());
+    while(!queue.empty()) {
+        events.push_back(queue.top());
+        queue.pop();
+    }
+    return events;
+}
+
+/**
+ * @brief Gets the sequence number the next scheduled event will get
+ * 
+ * @return unsigned long
+ */
+unsigned long EventQueue::getNextSequence() const {
+    return _nextSequence;
+}
+
+/**
+ * @brief Replaces the queue with saved events, keeping their sequence
+ * numbers so ties between them break the same way
+ * 
+ * @param events Events from getPending
+ * @param nextSequence Sequence number from getNextSequence
+ */
+void EventQueue::restore(const std::vector<Event> &events, unsigned long nextSequence) {
+    _events = decltype(_events)(Later{}, events);
+    _nextSequence = nextSequence;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file FaultScheduler.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "FaultScheduler.h"
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief Orders the earliest fault to the top of the queue
+ * 
+ * @return true if a happens after b
+ */
+bool FaultScheduler::Later::operator()(const Fault &a, const Fault &b) const {
+    if(a.timeMs != b.timeMs) return a.timeMs > b.timeMs;
+    return a.vehicle > b.vehicle;
+}
+
+/**
+ * @brief Construct a new Fault Scheduler:: Fault Scheduler object
+ * 
+ * @param rng Random number generator owned by the simulation
+ */
+FaultScheduler::FaultScheduler(Philox &rng)
+    : _rng{rng} {}
+
+/**
+ * @brief Forgets every vehicle and pending fault
+ * 
+ */
+void FaultScheduler::clear() {
+    _rate.clear();
+    _faults = {};
+}
+
+/**
+ * @brief Sets the fault rate of a vehicle
+ * 
+ * @param vehicle Index of the vehicle in the fleet
+ * @param rate Expected faults per simulated ms, zero if it never faults
+ */
+void FaultScheduler::addVehicle(size_t vehicle, double rate) {
+    if(vehicle >= _rate.size()) _rate.resize(vehicle + 1, 0.0);
+    _rate[vehicle] = rate;
+}
+
+/**
+ * @brief Draws the time of a vehicle's next fault
+ * 
+ * The exponential is inverted by hand so a seed gives the same times with
+ * any standard library.
+ * 
+ * @param vehicle Index of the vehicle in the fleet
+ * @param nowMs Simulated time the draw starts from
+ * @return double Simulated time of the fault, infinity if it never faults
+ */
+double FaultScheduler::drawFaultTime(size_t vehicle, double nowMs) {
+    double rate = _rate[vehicle];
+    if(rate <= 0.0) return std::numeric_limits<double>::infinity();
+    return nowMs - log1p(-_rng.nextDouble()) / rate;
+}
+
+/**
+ * @brief Draws the first fault of every vehicle into the scheduler's queue
+ * 
+ * Only needed by callers that use collectDue; the event engine puts the
+ * drawn times in its own queue.
+ * 
+ * @param nowMs Simulated time the simulation starts at
+ */
+void FaultScheduler::start(double nowMs) {
+    _faults = {};
+    for(size_t i = 0; i < _rate.size(); i++) {
+        double timeMs = drawFaultTime(i, nowMs);
+        if(std::isfinite(timeMs)) _faults.push({timeMs, i});
+    }
+}
+
+/**
+ * @brief Takes every fault due by a time and draws each vehicle's next one
+ * 
+ * @param nowMs Simulated time to collect faults up to, inclusive
+ * @param faulted Indices of the faulted vehicles are appended here, once per
+ * fault and in time order
+ */
+void FaultScheduler::collectDue(double nowMs, std::vector<size_t> &faulted) {
+    while(!_faults.empty() && _faults.top().timeMs <= nowMs) {
+        Fault fault = _faults.top();
+        _faults.pop();
+        faulted.push_back(fault.vehicle);
+        _faults.push({drawFaultTime(fault.vehicle, fault.timeMs), fault.vehicle});
+    }
+}
+
+/**
+ * @brief Gets the time of the next fault in the scheduler's queue
+ * 
+ * @return double Simulated time, infinity if none is pending
+ */
+double FaultScheduler::peekTime() const {
+    return _faults.empty() ? std::numeric_limits<double>::infinity() : _faults.top().timeMs;
+}
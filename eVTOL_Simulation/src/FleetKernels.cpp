@@ -0,0 +1,37 @@
+/**
+ * @file FleetKernels.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "FleetKernels.h"
+
+/**
+ * @brief Drains the flying batteries in a range of the fleet
+ * 
+ * @param fleet Fleet to drain
+ * @param ms Time in milliseconds flown
+ * @param begin First slot of the range
+ * @param end Slot one past the last of the range
+ * @param depleted Indices of vehicles whose battery emptied are appended here
+ */
+void FleetKernels::drainFlying(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &depleted) const {
+    fleet.drainFlying(ms, begin, end, depleted);
+}
+
+/**
+ * @brief Charges the batteries on a charger in a range of the fleet
+ * 
+ * @param fleet Fleet to charge
+ * @param ms Time in milliseconds spent charging
+ * @param begin First slot of the range
+ * @param end Slot one past the last of the range
+ * @param full Indices of vehicles whose battery filled are appended here
+ */
+void FleetKernels::chargeCharging(FleetState &fleet, double ms, size_t begin, size_t end, std::vector<size_t> &full) const {
+    fleet.chargeCharging(ms, begin, end, full);
+}
@@ -0,0 +1,566 @@
+/**
+ * @file FleetState.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "main.h"
+#include "FleetState.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Reserves room in every array for the given number of vehicles
+ *
+ * @param count Number of vehicles in the fleet
+ */
+void FleetState::reserve(size_t count) {
+    _chargeKwh.reserve(count);
+    _capacityKwh.reserve(count);
+    _energyUseKwh.reserve(count);
+    _chargeRateKwh.reserve(count);
+    _cruiseSpeedMph.reserve(count);
+    _passengerCount.reserve(count);
+    _status.reserve(count);
+    _type.reserve(count);
+    _chargeCurve.reserve(count);
+    _timeInFlightMs.reserve(count);
+    _distanceAllPassengersMi.reserve(count);
+    _timeChargingMs.reserve(count);
+    _timeAwaitingChargeMs.reserve(count);
+    _next.reserve(count);
+    _prev.reserve(count);
+    _group.reserve(count);
+    _vehicle.reserve(count);
+    _slot.reserve(count);
+}
+
+/**
+ * @brief Copies a vehicle and its battery into the arrays, starting in flight
+ *
+ * @param vehicle Vehicle to add
+ * @param group Group the vehicle's status lists belong to, e.g. its depot
+ * @return size_t Index of the vehicle in the fleet, the next free one
+ */
+size_t FleetState::addVehicle(const Vehicle &vehicle, size_t group) {
+    return addVehicle(vehicle, group, size());
+}
+
+/**
+ * @brief Copies a vehicle and its battery into the next slot, starting in
+ * flight
+ *
+ * @param vehicle Vehicle to add
+ * @param group Group the vehicle's status lists belong to, e.g. its depot
+ * @param index Index of the vehicle in the fleet, not yet added
+ * @return size_t Index of the vehicle in the fleet
+ */
+size_t FleetState::addVehicle(const Vehicle &vehicle, size_t group, size_t index) {
+    auto battery = vehicle.getBattery();
+    _chargeKwh.push_back(battery->getCharge(0.0));
+    _capacityKwh.push_back(battery->getCapacity());
+    _energyUseKwh.push_back(battery->getEnergyUse());
+    const ChargeCurve *curve = vehicle.getSpec().chargeCurve.get();
+    _chargeRateKwh.push_back(curve ? battery->getCapacity() / curve->getFullMs() : battery->getChargeRate());
+    _chargeCurve.push_back(curve);
+    _cruiseSpeedMph.push_back(vehicle.getCruiseSpeed());
+    _passengerCount.push_back(vehicle.getPassengerCount());
+    _status.push_back(VehicleStatus::FLYING);
+    _type.push_back(vehicle.getType());
+    _timeInFlightMs.push_back(0.0);
+    _distanceAllPassengersMi.push_back(0.0);
+    _timeChargingMs.push_back(0.0);
+    _timeAwaitingChargeMs.push_back(0.0);
+
+    // Extend the last run of vehicles if this one is the same type. Only
+    // long runs are kept, so a mixed fleet does not get a run per vehicle.
+    size_t slot = _type.size() - 1;
+    if(!_runs.empty() && _runs.back().type == vehicle.getType()) {
+        _runs.back().end++;
+    } else if(!_runs.empty() && _runs.back().end - _runs.back().begin < MIN_TYPE_RUN_LENGTH) {
+        _runs.back() = TypeRun{slot, slot + 1, vehicle.getType()};
+    } else {
+        _runs.push_back(TypeRun{slot, slot + 1, vehicle.getType()});
+    }
+    _vehicle.push_back(index);
+    if(index >= _slot.size()) _slot.resize(index + 1, END_OF_LIST);
+    _slot[index] = slot;
+
+    // Start on the flying list of its group
+    if((group + 1) * VEHICLE_STATUS_COUNT > _head.size()) {
+        _head.resize((group + 1) * VEHICLE_STATUS_COUNT, END_OF_LIST);
+        _count.resize((group + 1) * VEHICLE_STATUS_COUNT, 0);
+    }
+    _group.push_back(group);
+    _next.push_back(END_OF_LIST);
+    _prev.push_back(END_OF_LIST);
+    link(slot);
+    return index;
+}
+
+/**
+ * @brief Adds a whole fleet grouped by type, each type in fleet order, so
+ * the kernels step it as one run per type. The fleet indices stay those of
+ * the vector.
+ *
+ * @param vehicles Vehicles of the fleet, by fleet index
+ * @param groupOf Gets the group of a vehicle from its fleet index
+ */
+void FleetState::addFleet(const std::vector<std::shared_ptr<Vehicle>> &vehicles, const std::function<size_t(size_t)> &groupOf) {
+
+    // Counting sort by type keeps each type in fleet order
+    std::vector<size_t> start;
+    for(const auto &vehicle : vehicles) {
+        if(vehicle->getType() >= start.size()) start.resize(vehicle->getType() + 1, 0);
+        start[vehicle->getType()]++;
+    }
+    size_t total = 0;
+    for(auto &count : start) {
+        size_t next = total + count;
+        count = total;
+        total = next;
+    }
+    std::vector<size_t> order(vehicles.size());
+    for(size_t i = 0; i < vehicles.size(); i++) {
+        order[start[vehicles[i]->getType()]++] = i;
+    }
+
+    reserve(size() + vehicles.size());
+    for(auto i : order) {
+        addVehicle(*vehicles[i], groupOf(i), i);
+    }
+}
+
+/**
+ * @brief Gets the number of vehicles in the fleet
+ *
+ * @return size_t
+ */
+size_t FleetState::size() const {
+    return _status.size();
+}
+
+/**
+ * @brief Gets the charge left in a vehicle battery
+ *
+ * @param index Index of the vehicle
+ * @return double Charge in kWh
+ */
+double FleetState::getCharge(size_t index) const {
+    size_t slot = _slot[index];
+    if(_chargeCurve[slot] && _status[slot] == VehicleStatus::CHARGING) {
+        return _chargeCurve[slot]->getChargeAt(_chargeKwh[slot] / _chargeRateKwh[slot]);
+    }
+    return _chargeKwh[slot];
+}
+
+/**
+ * @brief Sets the charge left in a vehicle battery, e.g. to start it part
+ * charged
+ *
+ * @param index Index of the vehicle
+ * @param kwh Charge in kWh
+ */
+void FleetState::setCharge(size_t index, double kwh) {
+    size_t slot = _slot[index];
+    if(_chargeCurve[slot] && _status[slot] == VehicleStatus::CHARGING) {
+        _chargeKwh[slot] = _chargeCurve[slot]->getMsAt(kwh) * _chargeRateKwh[slot];
+    } else {
+        _chargeKwh[slot] = kwh;
+    }
+}
+
+/**
+ * @brief Gets the capacity of a vehicle battery
+ *
+ * @param index Index of the vehicle
+ * @return double Capacity in kWh
+ */
+double FleetState::getCapacity(size_t index) const {
+    return _capacityKwh[_slot[index]];
+}
+
+/**
+ * @brief Gets the type of a vehicle
+ * 
+ * @param index Index of the vehicle
+ * @return VehicleType Index of the vehicle spec in the registry
+ */
+VehicleType FleetState::getType(size_t index) const {
+    return _type[_slot[index]];
+}
+
+/**
+ * @brief Gets the runs of at least MIN_TYPE_RUN_LENGTH consecutive slots
+ * holding the same type, in slot order. The last run may be shorter. A fleet
+ * added with addFleet has one run per type.
+ *
+ * @return const std::vector<TypeRun>&
+ */
+const std::vector<TypeRun> &FleetState::getTypeRuns() const {
+    return _runs;
+}
+
+/**
+ * @brief Gets whether a vehicle is flying, queued or charging
+ *
+ * @param index Index of the vehicle
+ * @return VehicleStatus
+ */
+VehicleStatus FleetState::getStatus(size_t index) const {
+    return _status[_slot[index]];
+}
+
+/**
+ * @brief Sets whether a vehicle is flying, queued or charging
+ *
+ * @param index Index of the vehicle
+ * @param status New status of the vehicle
+ */
+void FleetState::setStatus(size_t index, VehicleStatus status) {
+    size_t slot = _slot[index];
+    if(_status[slot] == status) return;
+
+    // Move a tapering charge onto or off the charge curve's time axis
+    if(_chargeCurve[slot] && status == VehicleStatus::CHARGING) {
+        _chargeKwh[slot] = _chargeCurve[slot]->getMsAt(_chargeKwh[slot]) * _chargeRateKwh[slot];
+    } else if(_chargeCurve[slot] && _status[slot] == VehicleStatus::CHARGING) {
+        _chargeKwh[slot] = getCharge(index);
+    }
+    unlink(slot);
+    _status[slot] = status;
+    link(slot);
+}
+
+/**
+ * @brief Gets the group a vehicle's status lists belong to
+ * 
+ * @param index Index of the vehicle
+ * @return size_t 
+ */
+size_t FleetState::getGroup(size_t index) const {
+    return _group[_slot[index]];
+}
+
+/**
+ * @brief Gets the number of vehicles in the fleet with a status
+ * 
+ * @param status Status to count
+ * @return size_t 
+ */
+size_t FleetState::getStatusCount(VehicleStatus status) const {
+    size_t count = 0;
+    for(size_t list = (size_t)status; list < _count.size(); list += VEHICLE_STATUS_COUNT) {
+        count += _count[list];
+    }
+    return count;
+}
+
+/**
+ * @brief Gets the number of vehicles in a group with a status
+ * 
+ * @param group Group to count in
+ * @param status Status to count
+ * @return size_t 
+ */
+size_t FleetState::getStatusCount(size_t group, VehicleStatus status) const {
+    size_t list = group * VEHICLE_STATUS_COUNT + (size_t)status;
+    return (list < _count.size()) ? _count[list] : 0;
+}
+
+/**
+ * @brief Gets the time a vehicle has spent flying
+ *
+ * @param index Index of the vehicle
+ * @return double Time in milliseconds
+ */
+double FleetState::getTimeInFlight(size_t index) const {
+    return _timeInFlightMs[_slot[index]];
+}
+
+/**
+ * @brief Gets the distance a vehicle has flown times its passenger count
+ *
+ * @param index Index of the vehicle
+ * @return double Passenger miles
+ */
+double FleetState::getDistanceAllPassengers(size_t index) const {
+    return _distanceAllPassengersMi[_slot[index]];
+}
+
+/**
+ * @brief Gets the time a vehicle has spent on a charger
+ *
+ * @param index Index of the vehicle
+ * @return double Time in milliseconds
+ */
+double FleetState::getTimeCharging(size_t index) const {
+    return _timeChargingMs[_slot[index]];
+}
+
+/**
+ * @brief Gets the time a vehicle has spent in the charge queue
+ *
+ * @param index Index of the vehicle
+ * @return double Time in milliseconds
+ */
+double FleetState::getTimeAwaitingCharge(size_t index) const {
+    return _timeAwaitingChargeMs[_slot[index]];
+}
+
+/**
+ * @brief Adds time to a vehicle's time spent in the charge queue
+ *
+ * @param index Index of the vehicle
+ * @param ms Time in milliseconds to add
+ */
+void FleetState::addTimeAwaitingCharge(size_t index, double ms) {
+    _timeAwaitingChargeMs[_slot[index]] += ms;
+}
+
+/**
+ * @brief Drains every flying battery and adds flight time and distance
+ *
+ * @param ms Time in milliseconds flown
+ * @param depleted Indices of vehicles whose battery emptied are appended here
+ */
+void FleetState::drainFlying(double ms, std::vector<size_t> &depleted) {
+    drainFlying(ms, 0, size(), depleted);
+}
+
+/**
+ * @brief Drains the flying batteries in a range of the fleet. Ranges that
+ * do not overlap can be drained on separate threads.
+ *
+ * @param ms Time in milliseconds flown
+ * @param begin First slot of the range
+ * @param end Slot one past the last of the range
+ * @param depleted Indices of vehicles whose battery emptied are appended here
+ */
+void FleetState::drainFlying(double ms, size_t begin, size_t end, std::vector<size_t> &depleted) {
+    const size_t count = end;
+    const double hours = MS_TO_HR(ms);
+    size_t i = begin;
+
+#if defined(__AVX2__)
+    const __m256d step = _mm256_set1_pd(ms);
+    const __m256d stepHr = _mm256_set1_pd(hours);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256i flying = _mm256_set1_epi64x((long long)VehicleStatus::FLYING);
+    for(; i + 4 <= count; i += 4) {
+
+        // Widen four status bytes into a mask of the flying lanes
+        int packed;
+        std::memcpy(&packed, &_status[i], sizeof(packed));
+        __m256i status = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed));
+        __m256d mask = _mm256_castsi256_pd(_mm256_cmpeq_epi64(status, flying));
+
+        __m256d charge = _mm256_loadu_pd(&_chargeKwh[i]);
+        __m256d used = _mm256_mul_pd(_mm256_loadu_pd(&_energyUseKwh[i]), step);
+        __m256d drained = _mm256_max_pd(_mm256_sub_pd(charge, used), zero);
+        _mm256_storeu_pd(&_chargeKwh[i], _mm256_blendv_pd(charge, drained, mask));
+
+        __m256d flight = _mm256_loadu_pd(&_timeInFlightMs[i]);
+        _mm256_storeu_pd(&_timeInFlightMs[i], _mm256_add_pd(flight, _mm256_and_pd(step, mask)));
+
+        __m256d perHr = _mm256_mul_pd(_mm256_loadu_pd(&_cruiseSpeedMph[i]), _mm256_loadu_pd(&_passengerCount[i]));
+        __m256d miles = _mm256_and_pd(_mm256_mul_pd(perHr, stepHr), mask);
+        _mm256_storeu_pd(&_distanceAllPassengersMi[i], _mm256_add_pd(_mm256_loadu_pd(&_distanceAllPassengersMi[i]), miles));
+
+        int empty = _mm256_movemask_pd(_mm256_and_pd(_mm256_cmp_pd(drained, zero, _CMP_LE_OQ), mask));
+        for(int lane = 0; empty; lane++, empty >>= 1) {
+            if(empty & 1) depleted.push_back(_vehicle[i + lane]);
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128d step = _mm_set1_pd(ms);
+    const __m128d stepHr = _mm_set1_pd(hours);
+    const __m128d zero = _mm_setzero_pd();
+    for(; i + 2 <= count; i += 2) {
+
+        // Build a mask of the flying lanes
+        __m128d mask = _mm_castsi128_pd(_mm_set_epi64x(
+            -(long long)(_status[i + 1] == VehicleStatus::FLYING),
+            -(long long)(_status[i] == VehicleStatus::FLYING)));
+
+        __m128d charge = _mm_loadu_pd(&_chargeKwh[i]);
+        __m128d used = _mm_mul_pd(_mm_loadu_pd(&_energyUseKwh[i]), step);
+        __m128d drained = _mm_max_pd(_mm_sub_pd(charge, used), zero);
+        _mm_storeu_pd(&_chargeKwh[i], _mm_or_pd(_mm_and_pd(mask, drained), _mm_andnot_pd(mask, charge)));
+
+        __m128d flight = _mm_loadu_pd(&_timeInFlightMs[i]);
+        _mm_storeu_pd(&_timeInFlightMs[i], _mm_add_pd(flight, _mm_and_pd(step, mask)));
+
+        __m128d perHr = _mm_mul_pd(_mm_loadu_pd(&_cruiseSpeedMph[i]), _mm_loadu_pd(&_passengerCount[i]));
+        __m128d miles = _mm_and_pd(_mm_mul_pd(perHr, stepHr), mask);
+        _mm_storeu_pd(&_distanceAllPassengersMi[i], _mm_add_pd(_mm_loadu_pd(&_distanceAllPassengersMi[i]), miles));
+
+        int empty = _mm_movemask_pd(_mm_and_pd(_mm_cmple_pd(drained, zero), mask));
+        if(empty & 1) depleted.push_back(_vehicle[i]);
+        if(empty & 2) depleted.push_back(_vehicle[i + 1]);
+    }
+#endif
+
+    // Scalar fallback and tail of the vector loops
+    for(; i < count; i++) {
+        if(_status[i] != VehicleStatus::FLYING) continue;
+        double drained = _chargeKwh[i] - _energyUseKwh[i] * ms;
+        _chargeKwh[i] = (drained < 0.0) ? 0.0 : drained;
+        _timeInFlightMs[i] += ms;
+        _distanceAllPassengersMi[i] += _cruiseSpeedMph[i] * _passengerCount[i] * hours;
+        if(_chargeKwh[i] <= 0.0) depleted.push_back(_vehicle[i]);
+    }
+}
+
+/**
+ * @brief Charges every battery on a charger and adds charging time
+ *
+ * @param ms Time in milliseconds spent charging
+ * @param full Indices of vehicles whose battery filled are appended here
+ */
+void FleetState::chargeCharging(double ms, std::vector<size_t> &full) {
+    chargeCharging(ms, 0, size(), full);
+}
+
+/**
+ * @brief Charges the batteries on a charger in a range of the fleet. Ranges
+ * that do not overlap can be charged on separate threads.
+ *
+ * @param ms Time in milliseconds spent charging
+ * @param begin First slot of the range
+ * @param end Slot one past the last of the range
+ * @param full Indices of vehicles whose battery filled are appended here
+ */
+void FleetState::chargeCharging(double ms, size_t begin, size_t end, std::vector<size_t> &full) {
+    const size_t count = end;
+    size_t i = begin;
+
+#if defined(__AVX2__)
+    const __m256d step = _mm256_set1_pd(ms);
+    const __m256i charging = _mm256_set1_epi64x((long long)VehicleStatus::CHARGING);
+    for(; i + 4 <= count; i += 4) {
+
+        // Widen four status bytes into a mask of the charging lanes
+        int packed;
+        std::memcpy(&packed, &_status[i], sizeof(packed));
+        __m256i status = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed));
+        __m256d mask = _mm256_castsi256_pd(_mm256_cmpeq_epi64(status, charging));
+
+        __m256d charge = _mm256_loadu_pd(&_chargeKwh[i]);
+        __m256d added = _mm256_mul_pd(_mm256_loadu_pd(&_chargeRateKwh[i]), step);
+        __m256d capacity = _mm256_loadu_pd(&_capacityKwh[i]);
+        __m256d charged = _mm256_min_pd(_mm256_add_pd(charge, added), capacity);
+        _mm256_storeu_pd(&_chargeKwh[i], _mm256_blendv_pd(charge, charged, mask));
+
+        __m256d time = _mm256_loadu_pd(&_timeChargingMs[i]);
+        _mm256_storeu_pd(&_timeChargingMs[i], _mm256_add_pd(time, _mm256_and_pd(step, mask)));
+
+        int filled = _mm256_movemask_pd(_mm256_and_pd(_mm256_cmp_pd(charged, capacity, _CMP_GE_OQ), mask));
+        for(int lane = 0; filled; lane++, filled >>= 1) {
+            if(filled & 1) full.push_back(_vehicle[i + lane]);
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128d step = _mm_set1_pd(ms);
+    for(; i + 2 <= count; i += 2) {
+
+        // Build a mask of the charging lanes
+        __m128d mask = _mm_castsi128_pd(_mm_set_epi64x(
+            -(long long)(_status[i + 1] == VehicleStatus::CHARGING),
+            -(long long)(_status[i] == VehicleStatus::CHARGING)));
+
+        __m128d charge = _mm_loadu_pd(&_chargeKwh[i]);
+        __m128d added = _mm_mul_pd(_mm_loadu_pd(&_chargeRateKwh[i]), step);
+        __m128d capacity = _mm_loadu_pd(&_capacityKwh[i]);
+        __m128d charged = _mm_min_pd(_mm_add_pd(charge, added), capacity);
+        _mm_storeu_pd(&_chargeKwh[i], _mm_or_pd(_mm_and_pd(mask, charged), _mm_andnot_pd(mask, charge)));
+
+        __m128d time = _mm_loadu_pd(&_timeChargingMs[i]);
+        _mm_storeu_pd(&_timeChargingMs[i], _mm_add_pd(time, _mm_and_pd(step, mask)));
+
+        int filled = _mm_movemask_pd(_mm_and_pd(_mm_cmpge_pd(charged, capacity), mask));
+        if(filled & 1) full.push_back(_vehicle[i]);
+        if(filled & 2) full.push_back(_vehicle[i + 1]);
+    }
+#endif
+
+    // Scalar fallback and tail of the vector loops
+    for(; i < count; i++) {
+        if(_status[i] != VehicleStatus::CHARGING) continue;
+        double charged = _chargeKwh[i] + _chargeRateKwh[i] * ms;
+        _chargeKwh[i] = (charged > _capacityKwh[i]) ? _capacityKwh[i] : charged;
+        _timeChargingMs[i] += ms;
+        if(_chargeKwh[i] >= _capacityKwh[i]) full.push_back(_vehicle[i]);
+    }
+}
+
+/**
+ * @brief Charges the batteries on a charger in one group by walking its
+ * charging list. Groups can be charged on separate threads.
+ *
+ * @param ms Time in milliseconds spent charging
+ * @param group Group to charge, e.g. a depot
+ * @param full Indices of vehicles whose battery filled are appended here,
+ * in slot order like the fleet kernels
+ */
+void FleetState::chargeGroup(double ms, size_t group, std::vector<size_t> &full) {
+    size_t list = group * VEHICLE_STATUS_COUNT + (size_t)VehicleStatus::CHARGING;
+    if(list >= _head.size()) return;
+
+    // Same arithmetic as the scalar kernel, so the charges match a scan
+    size_t first = full.size();
+    for(size_t slot = _head[list]; slot != END_OF_LIST; slot = _next[slot]) {
+        double charged = _chargeKwh[slot] + _chargeRateKwh[slot] * ms;
+        _chargeKwh[slot] = (charged > _capacityKwh[slot]) ? _capacityKwh[slot] : charged;
+        _timeChargingMs[slot] += ms;
+        if(_chargeKwh[slot] >= _capacityKwh[slot]) full.push_back(slot);
+    }
+
+    // The list is in the order vehicles went on a charger
+    std::sort(full.begin() + first, full.end());
+    for(size_t i = first; i < full.size(); i++) {
+        full[i] = _vehicle[full[i]];
+    }
+}
+
+/*******************Private Member Methods***********************/
+/**
+ * @brief Pushes a vehicle onto the front of the list for its group and status
+ * 
+ * @param slot Slot of the vehicle
+ */
+void FleetState::link(size_t slot) {
+    size_t list = _group[slot] * VEHICLE_STATUS_COUNT + (size_t)_status[slot];
+    size_t head = _head[list];
+    _prev[slot] = END_OF_LIST;
+    _next[slot] = head;
+    if(head != END_OF_LIST) _prev[head] = slot;
+    _head[list] = slot;
+    _count[list]++;
+}
+
+/**
+ * @brief Removes a vehicle from the list for its group and status
+ * 
+ * @param slot Slot of the vehicle
+ */
+void FleetState::unlink(size_t slot) {
+    size_t list = _group[slot] * VEHICLE_STATUS_COUNT + (size_t)_status[slot];
+    if(_prev[slot] != END_OF_LIST) {
+        _next[_prev[slot]] = _next[slot];
+    } else {
+        _head[list] = _next[slot];
+    }
+    if(_next[slot] != END_OF_LIST) _prev[_next[slot]] = _prev[slot];
+    _next[slot] = END_OF_LIST;
+    _prev[slot] = END_OF_LIST;
+    _count[list]--;
+}
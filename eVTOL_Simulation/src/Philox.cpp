@@ -0,0 +1,126 @@
+/**
+ * @file Philox.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "Philox.h"
+
+// Round multipliers and Weyl key increments from the Philox paper
+constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+constexpr int PHILOX_ROUNDS = 10;
+
+/**
+ * @brief Construct a new Philox:: Philox object
+ * 
+ * @param seed Key of the generator
+ * @param stream Independent stream under the same seed, e.g. a replica number
+ */
+Philox::Philox(uint64_t seed, uint64_t stream)
+    : _seed{seed}
+    , _stream{stream} {}
+
+/**
+ * @brief Computes the four outputs at a counter without changing the state
+ * 
+ * @param counter Position in the stream
+ * @return Block Four independent 32 bit random numbers
+ */
+Philox::Block Philox::block(uint64_t counter) const {
+    Block ctr = {(uint32_t)counter, (uint32_t)(counter >> 32),
+        (uint32_t)_stream, (uint32_t)(_stream >> 32)};
+    uint32_t key0 = (uint32_t)_seed;
+    uint32_t key1 = (uint32_t)(_seed >> 32);
+
+    for(int round = 0; round < PHILOX_ROUNDS; round++) {
+        uint64_t product0 = (uint64_t)PHILOX_M0 * ctr[0];
+        uint64_t product1 = (uint64_t)PHILOX_M1 * ctr[2];
+        ctr = {(uint32_t)(product1 >> 32) ^ ctr[1] ^ key0, (uint32_t)product1,
+            (uint32_t)(product0 >> 32) ^ ctr[3] ^ key1, (uint32_t)product0};
+        key0 += PHILOX_W0;
+        key1 += PHILOX_W1;
+    }
+    return ctr;
+}
+
+/**
+ * @brief Gets the next number in the stream
+ * 
+ * @return result_type Uniform 32 bit random number
+ */
+Philox::result_type Philox::operator()() {
+    if(_buffered == 0) {
+        _buffer = block(_counter++);
+        _buffered = 4;
+    }
+    return _buffer[4 - _buffered--];
+}
+
+/**
+ * @brief Gets the next number in the stream as a double
+ * 
+ * @return double Uniform in [0, 1) with 53 bits of precision
+ */
+double Philox::nextDouble() {
+    uint32_t high = (*this)();
+    uint32_t low = (*this)();
+    return toDouble(high, low);
+}
+
+/**
+ * @brief Combines two outputs, e.g. two words of a block, into a double
+ * 
+ * @param high Output supplying the top 27 bits
+ * @param low Output supplying the bottom 26 bits
+ * @return double Uniform in [0, 1) with 53 bits of precision
+ */
+double Philox::toDouble(uint32_t high, uint32_t low) {
+    return ((high >> 5) * 67108864.0 + (low >> 6)) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief Gets the seed of the generator
+ * 
+ * @return uint64_t 
+ */
+uint64_t Philox::getSeed() const {
+    return _seed;
+}
+
+/**
+ * @brief Gets the stream of the generator
+ * 
+ * @return uint64_t 
+ */
+uint64_t Philox::getStream() const {
+    return _stream;
+}
+
+/**
+ * @brief Gets the position of the generator, to carry on from later
+ * 
+ * @return State
+ */
+Philox::State Philox::getState() const {
+    return State{_seed, _stream, _counter, _buffer, _buffered};
+}
+
+/**
+ * @brief Moves the generator to a position saved by getState
+ * 
+ * @param state Saved position
+ */
+void Philox::setState(const State &state) {
+    _seed = state.seed;
+    _stream = state.stream;
+    _counter = state.counter;
+    _buffer = state.buffer;
+    _buffered = state.buffered;
+}
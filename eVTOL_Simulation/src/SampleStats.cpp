@@ -0,0 +1,66 @@
+/**
+ * @file SampleStats.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "SampleStats.h"
+#include <cmath>
+
+// Two sided z value of a 95% confidence interval
+constexpr double Z_95 = 1.959963984540054;
+
+/**
+ * @brief Adds a sample to the running mean and variance
+ * 
+ * @param sample Value of the metric in one sample
+ */
+void SampleStats::add(double sample) {
+    _count++;
+    double delta = sample - _mean;
+    _mean += delta / _count;
+    _sumSquares += delta * (sample - _mean);
+}
+
+/**
+ * @brief Gets the number of samples
+ * 
+ * @return size_t 
+ */
+size_t SampleStats::getCount() const {
+    return _count;
+}
+
+/**
+ * @brief Gets the sample mean
+ * 
+ * @return double 
+ */
+double SampleStats::getMean() const {
+    return _mean;
+}
+
+/**
+ * @brief Gets the unbiased sample variance
+ * 
+ * @return double Zero with fewer than two samples
+ */
+double SampleStats::getVariance() const {
+    return (_count < 2) ? 0.0 : _sumSquares / (_count - 1);
+}
+
+/**
+ * @brief Gets the half width of the 95% confidence interval of the mean
+ * 
+ * Uses the normal approximation, which holds for the large replica counts
+ * a batch is run with.
+ * 
+ * @return double Mean +/- this value covers the true mean 95% of the time
+ */
+double SampleStats::getConfidence95() const {
+    return (_count < 2) ? 0.0 : Z_95 * sqrt(getVariance() / _count);
+}
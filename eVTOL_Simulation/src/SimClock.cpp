@@ -0,0 +1,138 @@
+/**
+ * @file SimClock.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "SimClock.h"
+#include <thread>
+
+/**
+ * @brief Creates a clock for the given mode
+ * 
+ * @param mode Real time, scaled or as fast as possible
+ * @param scale Simulated ms per wall ms, only used in scaled mode
+ * @return std::unique_ptr<SimClock>
+ */
+std::unique_ptr<SimClock> SimClock::create(ClockMode mode, double scale) {
+    switch(mode) {
+        case ClockMode::REAL_TIME:
+            return std::make_unique<RealTimeClock>();
+        case ClockMode::SCALED:
+            return std::make_unique<ScaledClock>(scale);
+        case ClockMode::FAST:
+        default:
+            return std::make_unique<FastClock>();
+    }
+}
+
+/*******************Scaled Clock***********************/
+/**
+ * @brief Construct a new Scaled Clock object
+ * 
+ * @param scale Simulated ms per wall ms, e.g. 60 for 1 min = 1 hr
+ */
+ScaledClock::ScaledClock(double scale)
+    : _scale{scale}
+    , _start{std::chrono::steady_clock::now()} {}
+
+/**
+ * @brief Restarts simulated time from now
+ * 
+ * @param simMs Simulated time to restart at, 0 for a new run
+ */
+void ScaledClock::reset(long long simMs) {
+    auto wallMs = std::chrono::duration<double, std::milli>(simMs / _scale);
+    _start = std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::steady_clock::duration>(wallMs);
+}
+
+/**
+ * @brief Gets the simulated time elapsed since reset
+ * 
+ * @return long long Simulated time in milliseconds
+ */
+long long ScaledClock::now() const {
+    using namespace std::chrono;
+    auto wallMs = duration<double, std::milli>(steady_clock::now() - _start).count();
+    return (long long)(wallMs * _scale);
+}
+
+/**
+ * @brief Sleeps until the wall time that maps to the given simulated time
+ * 
+ * @param simMs Simulated time in milliseconds
+ */
+void ScaledClock::advanceTo(long long simMs) {
+    auto wallMs = std::chrono::duration<double, std::milli>(simMs / _scale);
+    auto awakeTime = _start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(wallMs);
+
+    // Not a busy sleep, will yield to other threads
+    std::this_thread::sleep_until(awakeTime);
+}
+
+/**
+ * @brief Gets whether simulated time follows wall time
+ * 
+ * @return true, the loop can fall behind the clock
+ */
+bool ScaledClock::isPaced() const {
+    return true;
+}
+
+/**
+ * @brief Get the scale of the clock
+ * 
+ * @return double Simulated ms per wall ms
+ */
+double ScaledClock::getScale() const {
+    return _scale;
+}
+
+/*******************Real Time Clock***********************/
+/**
+ * @brief Construct a new Real Time Clock object
+ * 
+ */
+RealTimeClock::RealTimeClock()
+    : ScaledClock(1.0) {}
+
+/*******************Fast Clock***********************/
+/**
+ * @brief Restarts simulated time from now
+ * 
+ * @param simMs Simulated time to restart at, 0 for a new run
+ */
+void FastClock::reset(long long simMs) {
+    _now = simMs;
+}
+
+/**
+ * @brief Gets the simulated time the loop last advanced to
+ * 
+ * @return long long Simulated time in milliseconds
+ */
+long long FastClock::now() const {
+    return _now;
+}
+
+/**
+ * @brief Jumps straight to the given simulated time without sleeping
+ * 
+ * @param simMs Simulated time in milliseconds
+ */
+void FastClock::advanceTo(long long simMs) {
+    if(simMs > _now) _now = simMs;
+}
+
+/**
+ * @brief Gets whether simulated time follows wall time
+ * 
+ * @return false, the clock only moves when the loop advances it
+ */
+bool FastClock::isPaced() const {
+    return false;
+}
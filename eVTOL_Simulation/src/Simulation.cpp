@@ -1,196 +1,1011 @@
-/**
- * @file Simulation.cpp
- * @author Adrian Deardorff (80deardorff@gmail.com)
- * @version 0.1
- * @date 2022-05-11
- * 
- * @copyright Copyright (c) 2022
- * 
- */
-#include "main.h"
-#include "Simulation.h"
-#include <iostream>
-#include <iomanip>
-#include <random>
-#include <thread>
-#include <memory>
-#include <chrono>
-
-// Helper function prototypes
-static void manageVehiclesFlying(std::vector<std::shared_ptr<Vehicle>> &vehiclesFlying);
-static void manageChargers(std::vector<std::shared_ptr<Vehicle>> &vehiclesFlying, const std::vector<std::unique_ptr<Charger>> &chargers);
-
-/**
- * @brief Starts the simulation engine
- * 
- * @param vehicles Vector of simulation vehicles
- * @param chargers Vector of simulation chargers
- * @param ms Length of the test in milliseconds @
- */
-void Simulation::startSimulation(std::vector<std::shared_ptr<Vehicle>> &vehiclesFlying, const std::vector<std::unique_ptr<Charger>> &chargers, long ms) {
-   
-    _endTime = getCurrentTime() + ms;
-    _currTime = getCurrentTime();
-
-    // This sets an awake point for the next iteration of while loop. If the
-    // simulation starts to lag behind, it will catch up and keep timing
-    // calculations accurate.
-    auto awakeTime = std::chrono::steady_clock::now();
-
-    while(getTimeRemaining() > 0) {
-
-        // Set awake time of next loop
-        awakeTime += std::chrono::milliseconds(SIM_DELAY);
-        
-        // Print remaining time to terminal
-        printRemainingTime();
-
-        // Manage the vehicles flying
-        manageVehiclesFlying(vehiclesFlying);
-
-        // Manage the chargers
-        manageChargers(vehiclesFlying, chargers);
-
-        // Increase waiting time for vehicles in the charge queue
-        Charger::increaseTimeWaiting(SIM_DELAY);
-
-        // Check for vehicle faults in charge queue
-        Charger::faultCheckQueue();
-
-        // Not a busy sleep, will yield to other threads
-        std::this_thread::sleep_until(awakeTime);
-    }
-    std::cout << "\n" << std::endl;
-}
-
-/*******************Private Member Methods***********************/
-/**
- * @brief Get the current system time in milliseconds
- * 
- * @return long long 
- */
-inline long long Simulation::getCurrentTime() {
-    using namespace std::chrono;
-    _currTime = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
-    return _currTime;
-}
-
-/**
- * @brief Get the time remaining for the simulation in milliseconds
- * 
- * @return long long 
- */
-long long Simulation::getTimeRemaining() {
-    return (_endTime - getCurrentTime() < 0) ? 0 : _endTime - getCurrentTime();
-}
-
-/**
- * @brief Prints the remaining time in the simulation to the console
- * 
- */
-void Simulation::printRemainingTime() {
-    long long ms = getTimeRemaining();
-    int min = (int)MS_TO_SEC(ms) / 60;
-    int sec = (int)MS_TO_SEC(ms) % 60;
-    std::cout << '\r' << "Time remaining: "
-        << std::setw(2) << std::setfill('0') << min << ':'
-        << std::setw(2) << sec << std::flush;
-}
-
-/*******************Private Helper Functions***********************/
-static void manageVehiclesFlying(std::vector<std::shared_ptr<Vehicle>> &vehiclesFlying) {
-
-    // Run through vehicles flying and do the following:
-    //  - Check battery soc
-    //  - If 0% soc, send to charger queue
-    //  - If battery still has charge, we will drain it by the rate spec of
-    //    the vehicle and increase the total flight miles traveled
-    for(auto it = vehiclesFlying.begin(); it != vehiclesFlying.end(); /*For loop update within the loop*/ ) {
-
-        // Fault check vehicle
-        (*it)->faultCheck();
-
-        //Check battery SOC and push to charge queue if necessary
-        if((*it)->getBattery()->getStateOfCharge() <= 0.0) {
-            Charger::enqueueVehicleWaiting(*it);
-#if DEBUG_MODE
-                std::cout << (*it)->getName() << " queueing..." << std::endl;
-#endif /* DEBUG_MODE*/
-
-            // This deletes the current iterator as it will be a nullptr at
-            // by now due to the use of unique_ptr being moved to the charger
-            // queue
-            it = vehiclesFlying.erase(it);
-        }
-
-        // Battery SOC is fine so drain battery and add flight distance and time
-        else {
-            // Add to total flight time and miles traveled
-            (*it)->addTimeInFlight(SIM_DELAY);
-            
-            // Drain battery at rate for specific vehicle type
-            (*it)->getBattery()->drainBattery(SIM_DELAY);
-            it++;
-        }   
-    }
-}
-
-static void manageChargers(std::vector<std::shared_ptr<Vehicle>> &vehiclesFlying, const std::vector<std::unique_ptr<Charger>> &chargers) {
-
-    // Run through the chargers and do the following
-    //  - Get the vehicle on the charger
-    //  - If no vehicle exists on the charger, check the queue and add
-    //  - Check current vehicle on charger and see if it has full charge
-    //   -- If so, remove it and put back in flying vehicle vector and grab the next vehicle from the charge queue
-    //   -- If not, continue to charge it
-    for(auto &charger : chargers) {
-
-        // Get the vehicle on the charger
-        auto vehicle = charger->getVehicleCharging();
-
-        // If no vehicle on charger
-        if(!vehicle) {
-            if(Charger::isChargeQueueEmpty()) continue;
-            else {
-                vehicle = Charger::dequeueVehicleWaiting();
-                charger->setVehicleCharging(vehicle);
-#if DEBUG_MODE
-                std::cout << vehicle->getName() << " charging..." << std::endl;
-#endif /* DEBUG_MODE*/
-            }
-        }
-
-        // Fault check vehicle
-        vehicle->faultCheck();
-
-        // Charger has vehicle and it is still charging
-        if(vehicle->getBattery()->isCharging()) {
-            vehicle->addTimeCharging(SIM_DELAY);
-            continue;
-        }
-
-        // Charger has vehicle and it is charged
-        else if(vehicle->getBattery()->getStateOfCharge() >= 100.0) {
-
-            // Move vehicle off the charger and back into flying vehicles
-            vehiclesFlying.push_back(std::move(vehicle));
-            
-            // Get next vehicle from charge queue
-            if(Charger::isChargeQueueEmpty()) {
-                charger->setVehicleCharging(nullptr);
-                continue;
-            }
-            else {
-                vehicle = Charger::dequeueVehicleWaiting();
-                charger->setVehicleCharging(vehicle);
-                vehicle->addTimeCharging(SIM_DELAY);
-#if DEBUG_MODE
-                std::cout << vehicle->getName() << " charging..." << std::endl;
-#endif /* DEBUG_MODE*/
-            }
-        }
-
-        // Charge the current vehicle on the charger
-        vehicle->getBattery()->chargeBattery();
-    }
-}
+/**
+ * @file Simulation.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2022-05-11
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+#include "main.h"
+#include "Simulation.h"
+#include "EventQueue.h"
+#include "FleetState.h"
+#include "Trace.h"
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <memory>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+
+// Vehicles per chunk when the polling loop steps the fleet in parallel. A
+// multiple of the widest kernel lane count, so chunking never changes
+// which kernel path a vehicle takes.
+constexpr size_t STEP_CHUNK_SIZE = 16384;
+
+// Charging lists are walked while fewer than one vehicle in this many is
+// charging; above that a scan of the fleet with the kernels is cheaper
+constexpr size_t CHARGING_SCAN_SHARE = 16;
+
+// Paced polling loops coarsen their step up to this multiple of the set
+// step while they cannot keep up with the clock
+constexpr double MAX_STEP_COARSENING = 16.0;
+
+// Share of a step a paced tick may wake late before it counts as late
+constexpr double LATE_TICK_FRACTION = 0.1;
+
+// Late ticks in a row after which a paced loop coarsens its step, whether
+// the lag came from the tick's work or from sleeping past the clock
+constexpr uint64_t LATE_TICKS_TO_COARSEN = 3;
+
+// Events between trace counter samples in the event-driven engine
+constexpr uint64_t TRACE_EVENT_STRIDE = 4096;
+
+// Where a vehicle is in the event-driven simulation and since when
+enum class VehicleState {
+    FLYING,
+    WAITING,
+    CHARGING
+};
+
+struct VehicleRecord {
+    VehicleState state = VehicleState::FLYING;
+    double sinceMs = 0.0;
+};
+
+// Helper function prototypes
+static void forEachChunk(ThreadPool *pool, size_t count, const std::function<void(size_t, size_t, size_t)> &step);
+static void manageVehiclesFlying(FleetState &fleet, DepotNetwork &depots, ThreadPool *pool, const FleetKernels &kernels, [[maybe_unused]] const std::vector<std::shared_ptr<Vehicle>> &vehicles, std::vector<std::vector<size_t>> &depleted, double stepMs);
+static void manageDepots(FleetState &fleet, DepotNetwork &depots, ThreadPool *pool, const VehicleRegistry &registry, const std::vector<std::shared_ptr<Vehicle>> &vehicles, double stepMs);
+static void manageDepot(FleetState &fleet, Depot &depot, const VehicleRegistry &registry, [[maybe_unused]] const std::vector<std::shared_ptr<Vehicle>> &vehicles, double stepMs);
+static void chargeFleet(FleetState &fleet, DepotNetwork &depots, ThreadPool *pool, const FleetKernels &kernels, std::vector<std::vector<size_t>> &full, double stepMs);
+static void faultCheckFleet(FaultScheduler &faults, SimulationStats &stats, std::vector<size_t> &faulted, double nowMs);
+static void scheduleFault(EventQueue &events, FaultScheduler &faults, size_t index, double nowMs);
+static void admitFromQueue(EventQueue &events, ChargerPool &chargers, size_t depot, std::vector<VehicleRecord> &records, SimulationStats &stats, const std::vector<std::shared_ptr<Vehicle>> &vehicles, double nowMs);
+static void closeRecord(Vehicle &vehicle, size_t index, VehicleRecord &record, SimulationStats &stats, double nowMs);
+static void sampleFleet(const FleetState &fleet, const std::vector<std::vector<size_t>> &depleted, size_t chargerCount, double nowMs, TelemetrySample &sample);
+static void sampleEventFleet(const std::vector<std::shared_ptr<Vehicle>> &vehicles, const std::vector<VehicleRecord> &records, const SimulationStats &stats, size_t chargerCount, double nowMs, TelemetrySample &sample);
+static size_t getSocBin(double charge, double capacity);
+static uint64_t hashName(const std::string &name);
+
+/**
+ * @brief Construct a new Simulation:: Simulation object
+ * 
+ * @param clock Clock that paces the simulation (real time, scaled or fast)
+ * @param registry Specs of every vehicle type in the fleet
+ */
+Simulation::Simulation(SimClock &clock, const VehicleRegistry &registry)
+    : _clock{clock}
+    , _registry{registry}
+    , _rng{((uint64_t)std::random_device{}() << 32) | std::random_device{}()}
+    , _stepMs{SIM_STEP_MS} {}
+
+/**
+ * @brief Construct a new Simulation:: Simulation object with a fixed seed
+ * 
+ * Simulations with the same seed and fleet give the same results, so each
+ * replica of a batch can be given its own reproducible random stream.
+ * 
+ * @param clock Clock that paces the simulation (real time, scaled or fast)
+ * @param registry Specs of every vehicle type in the fleet
+ * @param seed Seed of the fault random number generator
+ * @param stream Independent fault stream under the same seed
+ */
+Simulation::Simulation(SimClock &clock, const VehicleRegistry &registry, uint64_t seed, uint64_t stream)
+    : _clock{clock}
+    , _registry{registry}
+    , _rng{seed, stream}
+    , _stepMs{SIM_STEP_MS} {}
+
+/**
+ * @brief Sets whether the polling loop prints the time remaining
+ * 
+ * @param show False to run silently, e.g. when replicas run in parallel
+ */
+void Simulation::setShowProgress(bool show) {
+    _showProgress = show;
+}
+
+/**
+ * @brief Sets the threads the polling loop steps the fleet and depots on.
+ * Results match a single threaded run exactly as long as depot arrivals are
+ * ordered.
+ * 
+ * @param pool Pool to step on, owned by the caller, or nullptr to step on
+ * the calling thread. Must not be the pool the simulation itself runs on.
+ */
+void Simulation::setStepPool(ThreadPool *pool) {
+    _stepPool = pool;
+}
+
+/**
+ * @brief Sets how far the polling loop advances simulated time each step.
+ * With a scaled or real time clock the loop coarsens the step, up to
+ * MAX_STEP_COARSENING times, while it cannot keep up.
+ * 
+ * @param ms Simulated milliseconds per step, SIM_STEP_MS by default
+ */
+void Simulation::setStepMs(double ms) {
+    _stepMs = ms;
+}
+
+/**
+ * @brief Sets the drain and charge kernels the polling loop runs
+ * 
+ * @param kernels Kernels owned by the caller, e.g. compile-time kernels for
+ * a fixed set of vehicle types, or nullptr for the runtime kernels
+ */
+void Simulation::setKernels(const FleetKernels *kernels) {
+    _kernels = (kernels != nullptr) ? kernels : &_runtimeKernels;
+}
+
+/**
+ * @brief Streams fleet metrics to a telemetry sink while the simulation runs
+ * 
+ * Each sample walks the whole fleet, so the period should be long next to
+ * the step for very large fleets.
+ * 
+ * @param sink Open sink owned by the caller, or nullptr for no telemetry
+ * @param periodMs Simulated milliseconds between samples, above 0; the
+ * first sample is at time 0
+ */
+void Simulation::setTelemetry(TelemetrySink *sink, double periodMs) {
+    _telemetry = sink;
+    _telemetryMs = periodMs;
+}
+
+/**
+ * @brief Starts the simulation engine
+ * 
+ * @param vehicles Vector of simulation vehicles, all starting in flight
+ * @param depots Charging depots and the depot each vehicle charges at
+ * @param ms Length of the test in simulated milliseconds
+ */
+void Simulation::startSimulation(const std::vector<std::shared_ptr<Vehicle>> &vehicles, DepotNetwork &depots, long ms) {
+
+    resetRun(vehicles, depots, true);
+
+    // Copy the fleet into contiguous arrays for the loop to work on, grouped
+    // by type so the fixed kernels step each type as one run
+    FleetState fleet;
+    fleet.addFleet(vehicles, [&depots](size_t i) { return depots.getDepotOf(i); });
+
+    // Vehicles that emptied or filled up in each chunk of the fleet
+    size_t chunks = (vehicles.size() + STEP_CHUNK_SIZE - 1) / STEP_CHUNK_SIZE;
+    std::vector<std::vector<size_t>> depleted(chunks);
+    std::vector<std::vector<size_t>> full(chunks);
+    std::vector<size_t> faulted;
+   
+    _clock.reset();
+    _endTime = getCurrentTime() + ms;
+    _currTime = getCurrentTime();
+
+    // Each tick integrates the fleet up to simMs, then waits for the clock
+    // to reach it. A fast clock takes exact steps so runs are reproducible,
+    // the last one clamped to the end when the step does not divide the run.
+    // A paced clock can run ahead of the loop, so each tick integrates the
+    // time that really passed, and the step coarsens while the work of a
+    // tick takes longer than the step itself or the loop keeps waking late.
+    bool paced = _clock.isPaced();
+    double simMs = (double)_currTime;
+    double stepMs = _stepMs;
+    double dtMs = std::min(_stepMs, _endTime - simMs);
+    uint64_t tick = 0;
+    uint64_t lateStreak = 0;
+    _faults.start(0.0);
+    TelemetrySample sample;
+    _nextSampleMs = 0.0;
+    if(_telemetry) {
+        sampleFleet(fleet, depleted, depots.getChargerCount(), 0.0, sample);
+        _telemetry->record(sample);
+        _nextSampleMs = _telemetryMs;
+    }
+
+    // A paced loop that fell behind still integrates up to the end, its last
+    // step clamped to it, rather than stopping when the clock gets there
+    while(simMs < _endTime) {
+        TRACE_SCOPE("tick");
+#if TRACE_MODE
+        uint64_t allocations = getThreadAllocations();
+#endif /* TRACE_MODE */
+        long long workStart = _currTime;
+
+        // Print remaining time to terminal
+        if(_showProgress) printRemainingTime();
+
+        // Manage the chargers and charge queue of each depot
+        manageDepots(fleet, depots, _stepPool, _registry, vehicles, dtMs);
+
+        // Charge every vehicle on a charger in one pass over the fleet
+        chargeFleet(fleet, depots, _stepPool, *_kernels, full, dtMs);
+
+        // Manage the vehicles flying
+        manageVehiclesFlying(fleet, depots, _stepPool, *_kernels, vehicles, depleted, dtMs);
+
+        // Count the faults drawn to land in this loop
+        simMs = paced ? simMs + dtMs : std::min(++tick * _stepMs, (double)_endTime);
+        faultCheckFleet(_faults, _stats, faulted, simMs);
+
+        // Sample the fleet once the loop reaches the next telemetry time
+        if(_telemetry && simMs >= _nextSampleMs) {
+            sampleFleet(fleet, depleted, depots.getChargerCount(), simMs, sample);
+            _telemetry->record(sample);
+            while(_nextSampleMs <= simMs) _nextSampleMs += _telemetryMs;
+        }
+
+        // Queue depth and heap allocations of this tick
+        TRACE_COUNTER("queued", fleet.getStatusCount(VehicleStatus::QUEUED));
+        TRACE_COUNTER("allocations", getThreadAllocations() - allocations);
+
+        // Let the clock pace the loop; a fast clock does not sleep
+        if(!paced) {
+            _clock.advanceTo((long long)simMs);
+            dtMs = std::min(_stepMs, _endTime - simMs);
+            continue;
+        }
+        double workMs = (double)(getCurrentTime() - workStart);
+        _clock.advanceTo((long long)simMs);
+
+        // Measure how far behind the clock the loop woke up, and integrate
+        // that lag into the next tick rather than drifting from wall time
+        double lagMs = std::max(0.0, (double)getCurrentTime() - simMs);
+        TRACE_COUNTER("tickOverrunMs", lagMs);
+        _pacing.ticks++;
+        _pacing.totalLagMs += lagMs;
+        _pacing.maxLagMs = std::max(_pacing.maxLagMs, lagMs);
+        bool late = lagMs > stepMs * LATE_TICK_FRACTION;
+        if(late) _pacing.lateTicks++;
+        lateStreak = late ? lateStreak + 1 : 0;
+
+        // Coarsen the step while a tick's work outlasts it or the loop keeps
+        // waking late, e.g. from sleep overshoot, and refine it back towards
+        // the set step once the work fits easily and the loop is on time
+        if(workMs >= stepMs || lateStreak >= LATE_TICKS_TO_COARSEN) {
+            stepMs = std::min(stepMs * 2.0, _stepMs * MAX_STEP_COARSENING);
+            lateStreak = 0;
+        } else if(workMs * 4.0 < stepMs && !late) {
+            stepMs = std::max(stepMs / 2.0, _stepMs);
+        }
+        _pacing.maxStepMs = std::max(_pacing.maxStepMs, stepMs);
+        dtMs = std::min(lagMs + stepMs, _endTime - simMs);
+    }
+    if(paced) _pacing.finalStepMs = stepMs;
+    if(_showProgress) std::cout << "\n" << std::endl;
+
+    // Fold the per vehicle totals into the simulation stats
+    for(size_t i = 0; i < vehicles.size(); i++) {
+        _stats.addTimeInFlight(i, fleet.getTimeInFlight(i));
+        _stats.addDistanceAllPassengers(i, fleet.getDistanceAllPassengers(i));
+        _stats.addTimeCharging(i, fleet.getTimeCharging(i));
+        _stats.addTimeAwaitingCharge(i, fleet.getTimeAwaitingCharge(i));
+    }
+}
+
+/**
+ * @brief Starts the discrete-event simulation engine
+ * 
+ * Battery drain and charge rates are linear, so the time a battery empties,
+ * a charge completes or the next fault occurs can be computed exactly. The
+ * engine jumps from one event to the next instead of polling every step, and
+ * batteries are only touched when a vehicle changes state, so a full test
+ * finishes in milliseconds rather than in scaled real time.
+ * 
+ * @param vehicles Vector of simulation vehicles, all starting in flight
+ * @param depots Charging depots and the depot each vehicle charges at
+ * @param ms Length of the test in simulated milliseconds
+ */
+void Simulation::startEventSimulation(const std::vector<std::shared_ptr<Vehicle>> &vehicles, DepotNetwork &depots, long ms) {
+
+    resetRun(vehicles, depots, false);
+
+    EventQueue events;
+    std::vector<VehicleRecord> records(vehicles.size());
+    _clock.reset();
+
+    // Every vehicle starts flying, its battery as the last run left it
+    for(size_t i = 0; i < vehicles.size(); i++) {
+        auto battery = vehicles[i]->getBattery();
+        battery->setMode(BatteryMode::DRAINING, 0.0);
+        events.schedule(battery->getTimeToEmpty(0.0), EventType::BATTERY_DEPLETED, i);
+        scheduleFault(events, _faults, i, 0.0);
+    }
+
+    _nextSampleMs = 0.0;
+    runEvents(events, records, vehicles, depots, 0.0, ms);
+}
+
+/**
+ * @brief Carries on an event-driven run from a checkpoint
+ * 
+ * The fleet and depots must be built as in the checkpointed run: the same
+ * vehicle types with the same specs in the same order and the same number
+ * of depots and chargers. Settings that only shape the rest of the run, such as its
+ * length or telemetry, can differ.
+ * 
+ * @param checkpoint Checkpoint read from a file
+ * @param vehicles Vector of simulation vehicles
+ * @param depots Charging depots and the depot each vehicle charges at
+ * @param ms Length of the whole test in simulated milliseconds, counted
+ * from the start of the checkpointed run
+ * @return true if the checkpoint fits the fleet and the run was carried on
+ */
+bool Simulation::resumeEventSimulation(const Checkpoint &checkpoint, const std::vector<std::shared_ptr<Vehicle>> &vehicles, DepotNetwork &depots, long ms) {
+
+    resetRun(vehicles, depots, false);
+    if(!matchesCheckpoint(checkpoint, vehicles, depots)) {
+        std::cerr << "Checkpoint does not match the vehicle specs, fleet and depots of this run" << std::endl;
+        return false;
+    }
+
+    // Put the random stream, totals and batteries back where they were
+    const auto &run = checkpoint.run;
+    Philox::State rng{run.rngSeed, run.rngStream, run.rngCounter,
+        {(uint32_t)run.rngBuffer[0], (uint32_t)run.rngBuffer[1], (uint32_t)run.rngBuffer[2], (uint32_t)run.rngBuffer[3]},
+        (unsigned)run.rngBuffered};
+    _rng.setState(rng);
+    for(size_t type = 0; type < checkpoint.types.size(); type++) {
+        const auto &totals = checkpoint.types[type];
+        TypeStats stats;
+        stats.timeInFlightHr = totals.timeInFlightHr;
+        stats.timeChargingHr = totals.timeChargingHr;
+        stats.timeAwaitingChargeHr = totals.timeAwaitingChargeHr;
+        stats.distanceAllPassengersMi = totals.distanceAllPassengersMi;
+        stats.faultCount = (int)totals.faultCount;
+        _stats.setTypeTotals(type, stats);
+    }
+    std::vector<VehicleRecord> records(vehicles.size());
+    for(size_t i = 0; i < vehicles.size(); i++) {
+        const auto &entry = checkpoint.vehicles[i];
+        VehicleStats stats;
+        stats.timeInFlightHr = entry.timeInFlightHr;
+        stats.timeChargingHr = entry.timeChargingHr;
+        stats.timeAwaitingChargeHr = entry.timeAwaitingChargeHr;
+        stats.distanceAllPassengersMi = entry.distanceAllPassengersMi;
+        stats.faultCount = (int)entry.faultCount;
+        _stats.setVehicleTotals(i, stats);
+        records[i] = {(VehicleState)entry.state, entry.sinceMs};
+        vehicles[i]->getBattery()->setState(BatteryState{entry.chargeKwh, entry.batterySinceMs, (BatteryMode)entry.batteryMode});
+    }
+
+    // Chargers and charge queue of every depot
+    for(size_t d = 0; d < depots.size(); d++) {
+        const auto &depot = checkpoint.depots[d];
+        auto first = checkpoint.chargers.begin() + depot.firstCharger;
+        std::vector<size_t> charging(first, first + depot.chargerCount);
+        first = checkpoint.idle.begin() + depot.firstIdle;
+        std::vector<size_t> idle(first, first + depot.idleCount);
+        std::vector<ChargeQueue::Entry> queued;
+        for(size_t q = depot.firstQueued; q < depot.firstQueued + depot.queuedCount; q++) {
+            const auto &entry = checkpoint.queued[q];
+            queued.push_back({entry.priority, (unsigned long)entry.sequence, (size_t)entry.vehicle});
+        }
+        depots[d].getChargers().restore(charging, idle, queued, depot.nextQueueSequence);
+    }
+
+    std::vector<Event> pending;
+    pending.reserve(checkpoint.events.size());
+    for(const auto &entry : checkpoint.events) {
+        pending.push_back({entry.timeMs, (unsigned long)entry.sequence, (EventType)entry.type,
+            (size_t)entry.vehicle, (size_t)entry.charger, (size_t)entry.depot});
+    }
+    EventQueue events;
+    events.restore(pending, run.nextEventSequence);
+
+    // Samples before the checkpoint were taken by the checkpointed run; if it
+    // took none, start on the sample grid
+    _nextSampleMs = run.nextSampleMs;
+    if(_telemetry && _nextSampleMs < run.nowMs) {
+        _nextSampleMs = std::ceil(run.nowMs / _telemetryMs) * _telemetryMs;
+    }
+    _clock.reset((long long)run.nowMs);
+    runEvents(events, records, vehicles, depots, run.nowMs, ms);
+    return true;
+}
+
+/**
+ * @brief Writes a checkpoint of the event-driven run once it reaches the
+ * given time
+ * 
+ * @param path Path of the checkpoint file, empty for none
+ * @param atMs Simulated time of the checkpoint; the end of the run if the
+ * run is shorter
+ */
+void Simulation::setCheckpoint(const std::string &path, double atMs) {
+    _checkpointFile = path;
+    _checkpointMs = atMs;
+}
+
+/**
+ * @brief Gets the statistics gathered by the last run
+ * 
+ * @return const SimulationStats& 
+ */
+const SimulationStats &Simulation::getStats() const {
+    return _stats;
+}
+
+/**
+ * @brief Gets how well the last paced polling run kept up with its clock
+ * 
+ * @return const PacingStats& Empty after a fast or event-driven run
+ */
+const PacingStats &Simulation::getPacingStats() const {
+    return _pacing;
+}
+
+/**
+ * @brief Prints the lag of the last paced polling run to the console
+ * 
+ */
+void Simulation::printPacingStats() const {
+    if(_pacing.ticks == 0) return;
+    std::cout << "Pacing: " << _pacing.ticks << " ticks, " << _pacing.lateTicks << " late, lag mean " <<
+        _pacing.totalLagMs / _pacing.ticks << " ms max " << _pacing.maxLagMs << " ms, step " <<
+        _stepMs << " ms coarsened up to " << _pacing.maxStepMs << " ms, ending at " << _pacing.finalStepMs << " ms" << std::endl;
+}
+
+/*******************Private Member Methods***********************/
+/**
+ * @brief Processes events in time order up to the end of the test, then
+ * closes every vehicle's last state
+ * 
+ * @param events Pending events
+ * @param records State of each vehicle and since when
+ * @param vehicles Vector of simulation vehicles
+ * @param depots Charging depots and the depot each vehicle charges at
+ * @param startMs Simulated time the run starts or resumes at
+ * @param ms Length of the test in simulated milliseconds
+ */
+void Simulation::runEvents(EventQueue &events, std::vector<VehicleRecord> &records, const std::vector<std::shared_ptr<Vehicle>> &vehicles, DepotNetwork &depots, double startMs, long ms) {
+    TelemetrySample sample;
+    bool checkpointed = _checkpointFile.empty();
+    TRACE_SCOPE("eventSimulation");
+#if TRACE_MODE
+    uint64_t processed = 0;
+    uint64_t allocations = getThreadAllocations();
+#endif /* TRACE_MODE */
+    while(!events.isEmpty() && events.peekTime() < ms) {
+
+        // Save the run between the last event before the checkpoint time
+        // and the first one at or after it, sampled up to that time
+        if(!checkpointed && events.peekTime() >= _checkpointMs) {
+            double checkpointMs = std::max(_checkpointMs, startMs);
+            while(_telemetry && _nextSampleMs < checkpointMs) {
+                sampleEventFleet(vehicles, records, _stats, depots.getChargerCount(), _nextSampleMs, sample);
+                _telemetry->record(sample);
+                _nextSampleMs += _telemetryMs;
+            }
+            writeCheckpoint(events, records, vehicles, depots, checkpointMs);
+            checkpointed = true;
+        }
+        Event event = events.pop();
+#if TRACE_MODE
+        if(++processed % TRACE_EVENT_STRIDE == 0) {
+            TRACE_COUNTER("eventsProcessed", processed);
+            TRACE_COUNTER("pendingEvents", events.size());
+            TRACE_COUNTER("allocations", getThreadAllocations() - allocations);
+            allocations = getThreadAllocations();
+        }
+#endif /* TRACE_MODE */
+
+        // Sample the fleet at every telemetry time up to this event; nothing
+        // changes between events but the linear drain and charge
+        while(_telemetry && _nextSampleMs <= event.timeMs) {
+            sampleEventFleet(vehicles, records, _stats, depots.getChargerCount(), _nextSampleMs, sample);
+            _telemetry->record(sample);
+            _nextSampleMs += _telemetryMs;
+        }
+
+        // Only paces the run when the clock is real time or scaled
+        _clock.advanceTo((long long)event.timeMs);
+
+        switch(event.type) {
+            case EventType::BATTERY_DEPLETED: {
+                auto &vehicle = vehicles[event.vehicle];
+                closeRecord(*vehicle, event.vehicle, records[event.vehicle], _stats, event.timeMs);
+                records[event.vehicle] = {VehicleState::WAITING, event.timeMs};
+                size_t depot = depots.getDepotOf(event.vehicle);
+                depots[depot].getChargers().enqueueVehicleWaiting(event.vehicle, vehicle->getSpec());
+                events.schedule(event.timeMs, EventType::QUEUE_ADMISSION, NO_INDEX, NO_INDEX, depot);
+#if DEBUG_MODE
+                std::cout << vehicle->getName() << " queueing..." << std::endl;
+#endif /* DEBUG_MODE*/
+                break;
+            }
+            case EventType::QUEUE_ADMISSION:
+                admitFromQueue(events, depots[event.depot].getChargers(), event.depot, records, _stats, vehicles, event.timeMs);
+                break;
+            case EventType::CHARGE_COMPLETE: {
+                auto &vehicle = vehicles[event.vehicle];
+                closeRecord(*vehicle, event.vehicle, records[event.vehicle], _stats, event.timeMs);
+                depots[event.depot].getChargers().release(event.charger);
+
+                // Send the vehicle back out and hand the charger to the queue
+                records[event.vehicle] = {VehicleState::FLYING, event.timeMs};
+                vehicle->getBattery()->setMode(BatteryMode::DRAINING, event.timeMs);
+                events.schedule(event.timeMs + vehicle->getBattery()->getTimeToEmpty(event.timeMs), EventType::BATTERY_DEPLETED, event.vehicle);
+                events.schedule(event.timeMs, EventType::QUEUE_ADMISSION, NO_INDEX, NO_INDEX, event.depot);
+                break;
+            }
+            case EventType::FAULT:
+                _stats.triggerFault(event.vehicle);
+                scheduleFault(events, _faults, event.vehicle, event.timeMs);
+                break;
+        }
+    }
+
+    if(!checkpointed) {
+        double checkpointMs = std::max(std::min(_checkpointMs, (double)ms), startMs);
+        while(_telemetry && _nextSampleMs < checkpointMs) {
+            sampleEventFleet(vehicles, records, _stats, depots.getChargerCount(), _nextSampleMs, sample);
+            _telemetry->record(sample);
+            _nextSampleMs += _telemetryMs;
+        }
+        writeCheckpoint(events, records, vehicles, depots, checkpointMs);
+    }
+
+    while(_telemetry && _nextSampleMs <= ms) {
+        sampleEventFleet(vehicles, records, _stats, depots.getChargerCount(), _nextSampleMs, sample);
+        _telemetry->record(sample);
+        _nextSampleMs += _telemetryMs;
+    }
+
+    // Account for the time each vehicle spent in its last state
+    _clock.advanceTo(ms);
+    for(size_t i = 0; i < vehicles.size(); i++) {
+        closeRecord(*vehicles[i], i, records[i], _stats, (double)ms);
+    }
+}
+
+/**
+ * @brief Writes the state of the event-driven run to the checkpoint file
+ * 
+ * @param events Pending events
+ * @param records State of each vehicle and since when
+ * @param vehicles Vector of simulation vehicles
+ * @param depots Charging depots and the depot each vehicle charges at
+ * @param nowMs Simulated time of the checkpoint, after every processed event
+ * @return true if the file was written
+ */
+bool Simulation::writeCheckpoint(const EventQueue &events, const std::vector<VehicleRecord> &records, const std::vector<std::shared_ptr<Vehicle>> &vehicles, const DepotNetwork &depots, double nowMs) const {
+    TRACE_SCOPE("writeCheckpoint");
+    Checkpoint checkpoint;
+    auto rng = _rng.getState();
+    checkpoint.run = Checkpoint::Run{nowMs, _nextSampleMs, events.getNextSequence(),
+        rng.seed, rng.stream, rng.counter, {rng.buffer[0], rng.buffer[1], rng.buffer[2], rng.buffer[3]}, rng.buffered};
+
+    for(size_t type = 0; type < _stats.getTypeCount(); type++) {
+        const auto &stats = _stats.getTypeStats(type);
+        const auto &spec = _registry[type];
+        checkpoint.types.push_back({stats.timeInFlightHr, stats.timeChargingHr, stats.timeAwaitingChargeHr,
+            stats.distanceAllPassengersMi, (uint64_t)stats.faultCount, hashName(spec.name),
+            (double)spec.cruiseSpeedMph, (double)spec.batteryCapacityKwh, spec.timeToChargeHr,
+            spec.energyUsePerMiKwh, (double)spec.passengerCount, spec.faultProbability, spec.chargeTaperSoc});
+    }
+    checkpoint.vehicles.reserve(vehicles.size());
+    for(size_t i = 0; i < vehicles.size(); i++) {
+        const auto &stats = _stats.getVehicleStats(i);
+        auto battery = vehicles[i]->getBattery()->getState();
+        checkpoint.vehicles.push_back({vehicles[i]->getType(), depots.getDepotOf(i), (uint64_t)records[i].state,
+            records[i].sinceMs, battery.chargeKwh, battery.sinceMs, (uint64_t)battery.mode,
+            stats.timeInFlightHr, stats.timeChargingHr, stats.timeAwaitingChargeHr,
+            stats.distanceAllPassengersMi, (uint64_t)stats.faultCount});
+    }
+    for(const auto &event : events.getPending()) {
+        checkpoint.events.push_back({event.timeMs, event.sequence, (uint64_t)event.type,
+            event.vehicle, event.charger, event.depot});
+    }
+
+    // Chargers, idle stack and queue heap of each depot, one after another
+    for(size_t d = 0; d < depots.size(); d++) {
+        const auto &chargers = depots[d].getChargers();
+        const auto &queue = chargers.getQueue();
+        checkpoint.depots.push_back({checkpoint.chargers.size(), chargers.size(), checkpoint.idle.size(),
+            chargers.getIdle().size(), checkpoint.queued.size(), queue.size(), queue.getNextSequence(),
+            (uint64_t)chargers.getPolicy()});
+        for(size_t c = 0; c < chargers.size(); c++) {
+            checkpoint.chargers.push_back(chargers[c].getVehicleCharging());
+        }
+        checkpoint.idle.insert(checkpoint.idle.end(), chargers.getIdle().begin(), chargers.getIdle().end());
+        for(const auto &entry : queue.getEntries()) {
+            checkpoint.queued.push_back({entry.priority, entry.sequence, entry.vehicle});
+        }
+    }
+    return checkpoint.write(_checkpointFile);
+}
+
+/**
+ * @brief Checks a checkpoint was taken from a run with the same vehicle
+ * specs, fleet and depots, and that its lists are consistent
+ * 
+ * @param checkpoint Checkpoint read from a file
+ * @param vehicles Vector of simulation vehicles
+ * @param depots Charging depots and the depot each vehicle charges at
+ * @return true if the run can be restored from it
+ */
+bool Simulation::matchesCheckpoint(const Checkpoint &checkpoint, const std::vector<std::shared_ptr<Vehicle>> &vehicles, const DepotNetwork &depots) const {
+    if(checkpoint.types.size() != _registry.size() ||
+        checkpoint.vehicles.size() != vehicles.size() ||
+        checkpoint.depots.size() != depots.size()) {
+        return false;
+    }
+
+    // The specs of every type must be the ones the checkpoint was run with,
+    // not just as many of them
+    for(size_t type = 0; type < _registry.size(); type++) {
+        const auto &entry = checkpoint.types[type];
+        const auto &spec = _registry[type];
+        if(entry.nameHash != hashName(spec.name) ||
+            entry.cruiseSpeedMph != spec.cruiseSpeedMph ||
+            entry.batteryCapacityKwh != spec.batteryCapacityKwh ||
+            entry.timeToChargeHr != spec.timeToChargeHr ||
+            entry.energyUsePerMiKwh != spec.energyUsePerMiKwh ||
+            entry.passengerCount != spec.passengerCount ||
+            entry.faultProbability != spec.faultProbability ||
+            entry.chargeTaperSoc != spec.chargeTaperSoc) {
+            return false;
+        }
+    }
+    for(size_t i = 0; i < vehicles.size(); i++) {
+        const auto &entry = checkpoint.vehicles[i];
+        if(entry.type != vehicles[i]->getType() || entry.depot != depots.getDepotOf(i)) return false;
+    }
+    for(size_t d = 0; d < depots.size(); d++) {
+        const auto &depot = checkpoint.depots[d];
+        if(depot.chargerCount != depots[d].getChargers().size() ||
+            depot.policy != (uint64_t)depots[d].getChargers().getPolicy() ||
+            depot.firstCharger + depot.chargerCount > checkpoint.chargers.size() ||
+            depot.firstIdle + depot.idleCount > checkpoint.idle.size() ||
+            depot.firstQueued + depot.queuedCount > checkpoint.queued.size()) {
+            return false;
+        }
+    }
+
+    // Every index must point into the fleet, the depots or their chargers
+    auto isVehicle = [&](uint64_t index, uint64_t none) { return index < vehicles.size() || index == none; };
+    for(const auto &event : checkpoint.events) {
+        if(!isVehicle(event.vehicle, NO_INDEX) || (event.depot >= depots.size() && event.depot != NO_INDEX) ||
+            (event.depot != NO_INDEX && event.charger >= depots[event.depot].getChargers().size() && event.charger != NO_INDEX)) {
+            return false;
+        }
+    }
+    for(auto vehicle : checkpoint.chargers) {
+        if(!isVehicle(vehicle, NO_VEHICLE)) return false;
+    }
+    for(const auto &depot : checkpoint.depots) {
+        for(size_t i = depot.firstIdle; i < depot.firstIdle + depot.idleCount; i++) {
+            if(checkpoint.idle[i] >= depot.chargerCount) return false;
+        }
+    }
+    for(const auto &entry : checkpoint.queued) {
+        if(entry.vehicle >= vehicles.size()) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Get the current simulation time in milliseconds
+ * 
+ * @return long long 
+ */
+inline long long Simulation::getCurrentTime() {
+    _currTime = _clock.now();
+    return _currTime;
+}
+
+/**
+ * @brief Get the time remaining for the simulation in milliseconds
+ * 
+ * @return long long 
+ */
+long long Simulation::getTimeRemaining() {
+    return (_endTime - getCurrentTime() < 0) ? 0 : _endTime - getCurrentTime();
+}
+
+/**
+ * @brief Prints the remaining time in the simulation to the console
+ * 
+ */
+void Simulation::printRemainingTime() {
+    TRACE_SCOPE("printRemainingTime");
+    long long ms = getTimeRemaining();
+    int hr = (int)MS_TO_SEC(ms) / 3600;
+    int min = (int)MS_TO_SEC(ms) / 60 % 60;
+    std::cout << '\r' << "Time remaining: "
+        << std::setw(2) << std::setfill('0') << hr << ':'
+        << std::setw(2) << min << std::flush;
+}
+
+/**
+ * @brief Frees the chargers, routes the fleet to the depots, clears the
+ * stats and registers every vehicle by its fleet index
+ * 
+ * @param vehicles Vector of simulation vehicles
+ * @param depots Charging depots and the depot each vehicle charges at
+ * @param polling The run steps the fleet and hands depleted vehicles to the
+ * depots' arrivals queues
+ */
+void Simulation::resetRun(const std::vector<std::shared_ptr<Vehicle>> &vehicles, DepotNetwork &depots, bool polling) {
+    depots.reset(vehicles.size(), polling);
+    _faults.clear();
+    _stats.clear();
+    _stats.reserve(vehicles.size());
+    _pacing = PacingStats{};
+    for(size_t i = 0; i < vehicles.size(); i++) {
+        _stats.addVehicle(*vehicles[i]);
+        _faults.addVehicle(i, vehicles[i]->getFaultRate());
+    }
+}
+
+/*******************Private Helper Functions***********************/
+static void forEachChunk(ThreadPool *pool, size_t count, const std::function<void(size_t, size_t, size_t)> &step) {
+
+    // Chunks are a fixed size whatever the thread count, so every vehicle
+    // lands in the same chunk and takes the same kernel path either way
+    size_t chunks = (count + STEP_CHUNK_SIZE - 1) / STEP_CHUNK_SIZE;
+    if(pool == nullptr || chunks <= 1) {
+        for(size_t c = 0; c < chunks; c++) {
+            step(c, c * STEP_CHUNK_SIZE, std::min(count, (c + 1) * STEP_CHUNK_SIZE));
+        }
+        return;
+    }
+    for(size_t c = 0; c < chunks; c++) {
+        pool->submit([&step, c, count] {
+            step(c, c * STEP_CHUNK_SIZE, std::min(count, (c + 1) * STEP_CHUNK_SIZE));
+        });
+    }
+    pool->wait();
+}
+
+static void manageVehiclesFlying(FleetState &fleet, DepotNetwork &depots, ThreadPool *pool, const FleetKernels &kernels, [[maybe_unused]] const std::vector<std::shared_ptr<Vehicle>> &vehicles, std::vector<std::vector<size_t>> &depleted, double stepMs) {
+    TRACE_SCOPE("manageVehiclesFlying");
+
+    // Drain every flying battery by the rate spec of the vehicle and increase
+    // the total flight time and miles traveled, one chunk of the fleet per
+    // task. Each chunk hands the vehicles that reached 0% soc to their depot
+    // itself; the arrivals queue holds every vehicle routed to the depot, so it
+    // cannot fail.
+    // The depot moves them to the queued list when it collects them.
+    if(fleet.getStatusCount(VehicleStatus::FLYING) == 0) {
+        for(auto &emptied : depleted) {
+            emptied.clear();
+        }
+        return;
+    }
+    forEachChunk(pool, fleet.size(), [&](size_t chunk, size_t begin, size_t end) {
+        TRACE_SCOPE("drainChunk");
+        auto &emptied = depleted[chunk];
+        emptied.clear();
+        kernels.drainFlying(fleet, stepMs, begin, end, emptied);
+        for(auto vehicle : emptied) {
+            depots[depots.getDepotOf(vehicle)].arrive(vehicle);
+        }
+    });
+
+#if DEBUG_MODE
+    for(const auto &emptied : depleted) {
+        for(auto vehicle : emptied) {
+            std::cout << vehicles[vehicle]->getName() << " queueing..." << std::endl;
+        }
+    }
+#endif /* DEBUG_MODE*/
+}
+
+static void manageDepots(FleetState &fleet, DepotNetwork &depots, ThreadPool *pool, const VehicleRegistry &registry, const std::vector<std::shared_ptr<Vehicle>> &vehicles, double stepMs) {
+    TRACE_SCOPE("manageDepots");
+
+    // A depot only touches the vehicles routed to it, so each depot can be
+    // stepped on its own thread
+    if(pool == nullptr || depots.size() <= 1) {
+        for(size_t d = 0; d < depots.size(); d++) {
+            manageDepot(fleet, depots[d], registry, vehicles, stepMs);
+        }
+        return;
+    }
+    for(size_t d = 0; d < depots.size(); d++) {
+        pool->submit([&, d] {
+            manageDepot(fleet, depots[d], registry, vehicles, stepMs);
+        });
+    }
+    pool->wait();
+}
+
+static void manageDepot(FleetState &fleet, Depot &depot, const VehicleRegistry &registry, [[maybe_unused]] const std::vector<std::shared_ptr<Vehicle>> &vehicles, double stepMs) {
+    TRACE_SCOPE("manageDepot");
+    auto &chargers = depot.getChargers();
+
+    // Move the vehicles that arrived last loop into the charge queue
+    for(auto vehicle : depot.collectArrivals()) {
+        fleet.setStatus(vehicle, VehicleStatus::QUEUED);
+        chargers.enqueueVehicleWaiting(vehicle, registry[fleet.getType(vehicle)]);
+    }
+
+    // Send the vehicles that filled up last loop back to flying and put
+    // their chargers back on the free list
+    for(auto vehicle : depot.getFull()) {
+        fleet.setStatus(vehicle, VehicleStatus::FLYING);
+        chargers.release(chargers.getChargerOf(vehicle));
+    }
+
+    // Hand every idle charger the next vehicle in line
+    while(chargers.canAdmit()) {
+        size_t charger;
+        auto vehicle = chargers.admitNext(charger);
+        fleet.setStatus(vehicle, VehicleStatus::CHARGING);
+#if DEBUG_MODE
+        std::cout << vehicles[vehicle]->getName() << " charging..." << std::endl;
+#endif /* DEBUG_MODE*/
+    }
+
+    // Increase waiting time for vehicles in the charge queue
+    chargers.increaseTimeWaiting(fleet, stepMs);
+}
+
+static void chargeFleet(FleetState &fleet, DepotNetwork &depots, ThreadPool *pool, const FleetKernels &kernels, std::vector<std::vector<size_t>> &full, double stepMs) {
+    TRACE_SCOPE("chargeFleet");
+
+    // Charge every vehicle on a charger for this loop. While only a small
+    // share of the fleet is charging, each depot walks its own charging list
+    // straight into its full list; the depots touch different vehicles, so
+    // each can run on its own thread.
+    for(size_t d = 0; d < depots.size(); d++) {
+        depots[d].getFull().clear();
+    }
+    size_t charging = fleet.getStatusCount(VehicleStatus::CHARGING);
+    if(charging == 0) return;
+    if(charging * CHARGING_SCAN_SHARE < fleet.size()) {
+        if(pool == nullptr || depots.size() <= 1) {
+            for(size_t d = 0; d < depots.size(); d++) {
+                fleet.chargeGroup(stepMs, d, depots[d].getFull());
+            }
+            return;
+        }
+        for(size_t d = 0; d < depots.size(); d++) {
+            pool->submit([&, d] {
+                fleet.chargeGroup(stepMs, d, depots[d].getFull());
+            });
+        }
+        pool->wait();
+        return;
+    }
+
+    // Otherwise scan the fleet with the kernels, one chunk per task
+    forEachChunk(pool, fleet.size(), [&](size_t chunk, size_t begin, size_t end) {
+        TRACE_SCOPE("chargeChunk");
+        full[chunk].clear();
+        kernels.chargeCharging(fleet, stepMs, begin, end, full[chunk]);
+    });
+
+    // Hand the ones that filled up back to their depots, merging the chunks
+    // in fleet order so the result matches a single threaded run
+    for(const auto &filled : full) {
+        for(auto vehicle : filled) {
+            depots[depots.getDepotOf(vehicle)].getFull().push_back(vehicle);
+        }
+    }
+}
+
+static void faultCheckFleet(FaultScheduler &faults, SimulationStats &stats, std::vector<size_t> &faulted, double nowMs) {
+    TRACE_SCOPE("faultCheckFleet");
+
+    // Vehicles can fault whether flying, queued or charging. Only vehicles
+    // whose drawn fault time has passed are touched, one draw per fault.
+    faulted.clear();
+    faults.collectDue(nowMs, faulted);
+    for(auto vehicle : faulted) {
+        stats.triggerFault(vehicle);
+    }
+}
+
+static void scheduleFault(EventQueue &events, FaultScheduler &faults, size_t index, double nowMs) {
+
+    // A vehicle that never faults gets no event
+    double timeMs = faults.drawFaultTime(index, nowMs);
+    if(std::isfinite(timeMs)) events.schedule(timeMs, EventType::FAULT, index);
+}
+
+static void admitFromQueue(EventQueue &events, ChargerPool &chargers, size_t depot, std::vector<VehicleRecord> &records, SimulationStats &stats, const std::vector<std::shared_ptr<Vehicle>> &vehicles, double nowMs) {
+
+    // Hand every idle charger the next vehicle in line
+    while(chargers.canAdmit()) {
+        size_t charger;
+        size_t index = chargers.admitNext(charger);
+        auto &vehicle = vehicles[index];
+        closeRecord(*vehicle, index, records[index], stats, nowMs);
+        records[index] = {VehicleState::CHARGING, nowMs};
+        vehicle->getBattery()->setMode(BatteryMode::CHARGING, nowMs);
+        events.schedule(nowMs + vehicle->getBattery()->getTimeToFull(nowMs), EventType::CHARGE_COMPLETE, index, charger, depot);
+#if DEBUG_MODE
+        std::cout << vehicle->getName() << " charging..." << std::endl;
+#endif /* DEBUG_MODE*/
+    }
+}
+
+static void closeRecord(Vehicle &vehicle, size_t index, VehicleRecord &record, SimulationStats &stats, double nowMs) {
+
+    // Apply the time spent in the current state to the totals and settle the
+    // battery until the caller gives it its next mode
+    double elapsed = nowMs - record.sinceMs;
+    switch(record.state) {
+        case VehicleState::FLYING:
+            stats.addTimeInFlight(index, elapsed);
+            stats.addDistanceAllPassengers(index, (double)vehicle.getPassengerCount() * vehicle.getCruiseSpeed() * MS_TO_HR(elapsed));
+            break;
+        case VehicleState::WAITING:
+            stats.addTimeAwaitingCharge(index, elapsed);
+            break;
+        case VehicleState::CHARGING:
+            stats.addTimeCharging(index, elapsed);
+            break;
+    }
+    vehicle.getBattery()->setMode(BatteryMode::IDLE, nowMs);
+    record.sinceMs = nowMs;
+}
+
+static void sampleFleet(const FleetState &fleet, const std::vector<std::vector<size_t>> &depleted, size_t chargerCount, double nowMs, TelemetrySample &sample) {
+    TRACE_SCOPE("sampleFleet");
+    sample = TelemetrySample{};
+    sample.timeMs = nowMs;
+
+    // Vehicles that emptied this tick are still flying until their depot
+    // collects them next tick, but are already waiting for a charger
+    uint64_t arriving = 0;
+    for(const auto &emptied : depleted) {
+        arriving += emptied.size();
+    }
+    sample.flying = fleet.getStatusCount(VehicleStatus::FLYING) - arriving;
+    sample.queued = fleet.getStatusCount(VehicleStatus::QUEUED) + arriving;
+    sample.charging = fleet.getStatusCount(VehicleStatus::CHARGING);
+    sample.chargerUtilization = chargerCount ? (double)sample.charging / chargerCount : 0.0;
+    for(size_t i = 0; i < fleet.size(); i++) {
+        sample.soc[getSocBin(fleet.getCharge(i), fleet.getCapacity(i))]++;
+        sample.distanceAllPassengersMi += fleet.getDistanceAllPassengers(i);
+    }
+}
+
+static void sampleEventFleet(const std::vector<std::shared_ptr<Vehicle>> &vehicles, const std::vector<VehicleRecord> &records, const SimulationStats &stats, size_t chargerCount, double nowMs, TelemetrySample &sample) {
+    TRACE_SCOPE("sampleEventFleet");
+    sample = TelemetrySample{};
+    sample.timeMs = nowMs;
+    for(size_t i = 0; i < vehicles.size(); i++) {
+
+        // Totals are brought up to date when a record closes, so add the part
+        // of the current state already elapsed; batteries know their charge
+        // at any time
+        const auto &vehicle = *vehicles[i];
+        const auto battery = vehicle.getBattery();
+        double elapsed = nowMs - records[i].sinceMs;
+        sample.distanceAllPassengersMi += stats.getVehicleStats(i).distanceAllPassengersMi;
+        switch(records[i].state) {
+            case VehicleState::FLYING:
+                sample.flying++;
+                sample.distanceAllPassengersMi += (double)vehicle.getPassengerCount() * vehicle.getCruiseSpeed() * MS_TO_HR(elapsed);
+                break;
+            case VehicleState::WAITING:
+                sample.queued++;
+                break;
+            case VehicleState::CHARGING:
+                sample.charging++;
+                break;
+        }
+        sample.soc[getSocBin(battery->getCharge(nowMs), battery->getCapacity())]++;
+    }
+    sample.chargerUtilization = chargerCount ? (double)sample.charging / chargerCount : 0.0;
+}
+
+static size_t getSocBin(double charge, double capacity) {
+    size_t bin = (size_t)(charge / capacity * TELEMETRY_SOC_BINS);
+    return (bin < TELEMETRY_SOC_BINS) ? bin : TELEMETRY_SOC_BINS - 1;
+}
+
+static uint64_t hashName(const std::string &name) {
+
+    // 64 bit FNV-1a, stable across builds unlike std::hash
+    uint64_t hash = 14695981039346656037ULL;
+    for(unsigned char c : name) {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    return hash;
+}
@@ -0,0 +1,333 @@
+/**
+ * @file SimulationConfig.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "main.h"
+#include "SimulationConfig.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// Helper function prototypes
+static std::string trim(const std::string &text);
+static bool parseSize(const std::string &value, size_t &out);
+static bool parseDouble(const std::string &value, double &out);
+static bool parseBool(const std::string &value, bool &out);
+static bool parseMix(const std::string &value, FleetMix &out);
+static bool parsePolicy(const std::string &value, QueuePolicy &out);
+static bool parseClock(const std::string &value, ClockMode &out);
+
+/**
+ * @brief Construct a new Simulation Config:: Simulation Config object with
+ * the defaults from main.h
+ * 
+ */
+SimulationConfig::SimulationConfig()
+    : vehicles{NUM_OF_TEST_VEHICLES}
+    , mix FLEET_MIX
+    , depots{NUM_OF_DEPOTS}
+    , chargers{NUM_OF_CHARGERS}
+    , policy{CHARGE_QUEUE_POLICY}
+    , orderedArrivals{ORDERED_ARRIVALS}
+    , hours{(double)SIM_LENGTH_MS / HR_TO_MS(1)}
+    , stepMs{SIM_STEP_MS}
+    , clockMode{CLOCK_MODE}
+    , timeScale{TIME_SCALE_FACTOR}
+    , eventDriven{EVENT_DRIVEN}
+    , stepThreads{STEP_THREADS}
+    , fixedKernels{FIXED_KERNELS}
+    , replicas{BATCH_REPLICAS}
+    , vehicleFile{VEHICLE_CONFIG_FILE}
+    , telemetryFile{TELEMETRY_FILE}
+    , telemetryFormat{TELEMETRY_FORMAT}
+    , telemetryMs{TELEMETRY_PERIOD_MS} {}
+
+/**
+ * @brief Applies one setting by name
+ * 
+ * @param key Name of the setting, as in printUsage without the dashes
+ * @param value Value of the setting
+ * @return true The setting was applied
+ * @return false The key is unknown or the value is invalid
+ */
+bool SimulationConfig::set(const std::string &key, const std::string &value) {
+    bool valid;
+    if(key == "vehicles") {
+        valid = parseSize(value, vehicles) && vehicles > 0;
+    } else if(key == "mix") {
+        valid = parseMix(value, mix);
+    } else if(key == "depots") {
+        valid = parseSize(value, depots) && depots > 0;
+    } else if(key == "chargers") {
+        valid = parseSize(value, chargers);
+    } else if(key == "policy") {
+        valid = parsePolicy(value, policy);
+    } else if(key == "ordered-arrivals") {
+        valid = parseBool(value, orderedArrivals);
+    } else if(key == "hours") {
+        valid = parseDouble(value, hours) && hours > 0.0;
+    } else if(key == "step-ms") {
+        valid = parseDouble(value, stepMs) && stepMs > 0.0;
+    } else if(key == "seed") {
+        size_t seedValue;
+        valid = parseSize(value, seedValue);
+        if(valid) seed = seedValue;
+        hasSeed = hasSeed || valid;
+    } else if(key == "clock") {
+        valid = parseClock(value, clockMode);
+    } else if(key == "scale") {
+        valid = parseDouble(value, timeScale) && timeScale > 0.0;
+    } else if(key == "engine") {
+        valid = (value == "event" || value == "polling");
+        eventDriven = (value == "event");
+    } else if(key == "threads") {
+        valid = parseSize(value, threads);
+    } else if(key == "step-threads") {
+        valid = parseSize(value, stepThreads);
+    } else if(key == "kernels") {
+        valid = (value == "runtime" || value == "fixed");
+        fixedKernels = (value == "fixed");
+    } else if(key == "replicas") {
+        valid = parseSize(value, replicas);
+    } else if(key == "vehicle-file") {
+        valid = !value.empty();
+        vehicleFile = value;
+    } else if(key == "telemetry") {
+        valid = true;
+        telemetryFile = value;
+    } else if(key == "telemetry-format") {
+        valid = (value == "binary" || value == "csv");
+        telemetryFormat = (value == "csv") ? TelemetryFormat::CSV : TelemetryFormat::BINARY;
+    } else if(key == "telemetry-ms") {
+        valid = parseDouble(value, telemetryMs) && telemetryMs > 0.0;
+    } else if(key == "trace") {
+        valid = true;
+        traceFile = value;
+    } else if(key == "checkpoint") {
+        valid = true;
+        checkpointFile = value;
+    } else if(key == "checkpoint-hr") {
+        valid = parseDouble(value, checkpointHours) && checkpointHours >= 0.0;
+    } else if(key == "restore") {
+        valid = true;
+        restoreFile = value;
+    } else if(key == "output") {
+        valid = (value == "text" || value == "csv");
+        output = (value == "csv") ? OutputFormat::CSV : OutputFormat::TEXT;
+    } else if(key == "progress") {
+        valid = parseBool(value, showProgress);
+    } else {
+        std::cerr << "Unknown setting " << key << std::endl;
+        return false;
+    }
+
+    if(!valid) std::cerr << "Invalid value '" << value << "' for " << key << std::endl;
+    if(valid) given.insert(key);
+    return valid;
+}
+
+/**
+ * @brief Applies every key = value line of a config file. Blank lines and
+ * lines starting with # are skipped.
+ * 
+ * @param path Path to the config file
+ * @return true Every line was applied
+ * @return false The file could not be opened or a line is invalid
+ */
+bool SimulationConfig::loadFile(const std::string &path) {
+    std::ifstream file(path);
+    if(!file.is_open()) {
+        std::cerr << "Could not open config file " << path << std::endl;
+        return false;
+    }
+
+    std::string line;
+    size_t lineNumber = 0;
+    while(std::getline(file, line)) {
+        lineNumber++;
+        line = trim(line);
+        if(line.empty() || line[0] == '#') continue;
+
+        auto equals = line.find('=');
+        if(equals == std::string::npos || !set(trim(line.substr(0, equals)), trim(line.substr(equals + 1)))) {
+            std::cerr << path << ":" << lineNumber << ": expected key = value" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Applies the command line in order, so later settings override
+ * earlier ones and a --config file. Settings are --key value or --key=value.
+ * 
+ * @param argc Argument count from main
+ * @param argv Arguments from main
+ * @param exit Set when the program should stop without running, e.g. --help
+ * @return true The command line was applied
+ * @return false An argument is invalid
+ */
+bool SimulationConfig::parseArgs(int argc, char **argv, bool &exit) {
+    exit = false;
+    for(int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if(arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            exit = true;
+            return true;
+        }
+        if(arg.compare(0, 2, "--") != 0) {
+            std::cerr << "Unexpected argument " << arg << std::endl;
+            return false;
+        }
+
+        std::string key = arg.substr(2);
+        std::string value;
+        auto equals = key.find('=');
+        if(equals != std::string::npos) {
+            value = key.substr(equals + 1);
+            key = key.substr(0, equals);
+        } else if(i + 1 < argc) {
+            value = argv[++i];
+        } else {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+
+        if(!((key == "config") ? loadFile(value) : set(key, value))) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Gets the length of the run
+ * 
+ * @return long Simulated milliseconds
+ */
+long SimulationConfig::getLengthMs() const {
+    return HR_TO_MS(hours);
+}
+
+/**
+ * @brief Prints the command line settings and their defaults
+ * 
+ * @param program Name the program was run as
+ */
+void SimulationConfig::printUsage(const char *program) {
+    SimulationConfig defaults;
+    std::cout << "Usage: " << program << " [--key value | --key=value]...\n" <<
+        "  --config FILE             apply a file of key = value lines\n" <<
+        "  --vehicles N              fleet size (" << defaults.vehicles << ")\n" <<
+        "  --mix A,B,...             share of each vehicle type, empty for even\n" <<
+        "  --depots N                charging depots (" << defaults.depots << ")\n" <<
+        "  --chargers N              chargers per depot (" << defaults.chargers << ")\n" <<
+        "  --policy NAME             fifo, shortest-charge-first or highest-passenger-value-first\n" <<
+        "  --ordered-arrivals BOOL   sort depot arrivals for reproducible threaded runs\n" <<
+        "  --hours H                 simulated hours (" << defaults.hours << ")\n" <<
+        "  --step-ms MS              simulated ms per polling step (" << defaults.stepMs << ")\n" <<
+        "  --seed N                  seed of the run, from the time if not given\n" <<
+        "  --clock NAME              fast, scaled or real-time\n" <<
+        "  --scale X                 simulated ms per wall ms when scaled (" << defaults.timeScale << ")\n" <<
+        "  --engine NAME             event or polling (" << (defaults.eventDriven ? "event" : "polling") << ")\n" <<
+        "  --threads N               batch replica threads, 0 for all cores\n" <<
+        "  --step-threads N          polling step threads, 0 for all cores (" << defaults.stepThreads << ")\n" <<
+        "  --kernels NAME            runtime, or fixed for the compiled-in vehicle types (" << (defaults.fixedKernels ? "fixed" : "runtime") << ")\n" <<
+        "  --replicas N              Monte Carlo replicas, 0 for one run (" << defaults.replicas << ")\n" <<
+        "  --vehicle-file FILE       vehicle specs (" << defaults.vehicleFile << ")\n" <<
+        "  --telemetry FILE          stream fleet metrics of a single run to FILE\n" <<
+        "  --telemetry-format NAME   binary (columnar chunks) or csv\n" <<
+        "  --telemetry-ms MS         simulated ms between samples (" << defaults.telemetryMs << ")\n" <<
+        "  --trace FILE              write Chrome trace JSON of the run, needs a TRACE_MODE build\n" <<
+        "  --checkpoint FILE         save the state of an event-driven run to FILE\n" <<
+        "  --checkpoint-hr H         simulated hour to save it at, 0 for the end of the run\n" <<
+        "  --restore FILE            carry on an event-driven run from a checkpoint up to --hours\n" <<
+        "  --output NAME             text or csv\n" <<
+        "  --progress BOOL           print the time remaining while polling" << std::endl;
+}
+
+/*******************Private Helper Functions***********************/
+static std::string trim(const std::string &text) {
+    auto first = text.find_first_not_of(" \t\r\n");
+    if(first == std::string::npos) return "";
+    auto last = text.find_last_not_of(" \t\r\n");
+    return text.substr(first, last - first + 1);
+}
+
+static bool parseSize(const std::string &value, size_t &out) {
+    if(value.empty() || value[0] == '-') return false;
+    std::istringstream stream(value);
+    size_t parsed;
+    if(!(stream >> parsed) || !stream.eof()) return false;
+    out = parsed;
+    return true;
+}
+
+static bool parseDouble(const std::string &value, double &out) {
+    std::istringstream stream(value);
+    double parsed;
+    if(!(stream >> parsed) || !stream.eof()) return false;
+    out = parsed;
+    return true;
+}
+
+static bool parseBool(const std::string &value, bool &out) {
+    if(value == "1" || value == "true" || value == "on") {
+        out = true;
+    } else if(value == "0" || value == "false" || value == "off") {
+        out = false;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool parseMix(const std::string &value, FleetMix &out) {
+    FleetMix parsed;
+    std::istringstream stream(value);
+    std::string share;
+    while(std::getline(stream, share, ',')) {
+        double weight;
+        if(!parseDouble(trim(share), weight) || weight < 0.0) return false;
+        parsed.push_back(weight);
+    }
+
+    // An empty mix is even, but one given must share out some vehicles
+    if(!parsed.empty() && std::all_of(parsed.begin(), parsed.end(), [](double weight) { return weight == 0.0; })) {
+        return false;
+    }
+    out = parsed;
+    return true;
+}
+
+static bool parsePolicy(const std::string &value, QueuePolicy &out) {
+    if(value == "fifo") {
+        out = QueuePolicy::FIFO;
+    } else if(value == "shortest-charge-first") {
+        out = QueuePolicy::SHORTEST_CHARGE_FIRST;
+    } else if(value == "highest-passenger-value-first") {
+        out = QueuePolicy::HIGHEST_PASSENGER_VALUE_FIRST;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool parseClock(const std::string &value, ClockMode &out) {
+    if(value == "fast") {
+        out = ClockMode::FAST;
+    } else if(value == "scaled") {
+        out = ClockMode::SCALED;
+    } else if(value == "real-time") {
+        out = ClockMode::REAL_TIME;
+    } else {
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file SimulationStats.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "main.h"
+#include "SimulationStats.h"
+#include <iostream>
+
+/**
+ * @brief Resets every total and forgets all vehicles
+ * 
+ */
+void SimulationStats::clear() {
+    _types.clear();
+    _vehicles.clear();
+}
+
+/**
+ * @brief Reserves room for the given number of vehicles
+ * 
+ * @param count Number of vehicles in the fleet
+ */
+void SimulationStats::reserve(size_t count) {
+    _vehicles.reserve(count);
+}
+
+/**
+ * @brief Adds a vehicle to the totals of its company
+ * 
+ * @param vehicle Vehicle to add
+ * @return size_t Index of the vehicle's slot, matching its fleet index
+ */
+size_t SimulationStats::addVehicle(const Vehicle &vehicle) {
+    if(vehicle.getType() >= _types.size()) _types.resize(vehicle.getType() + 1);
+    auto &type = _types[vehicle.getType()];
+    if(type.name.empty()) type.name = vehicle.getName();
+    type.vehicleCount++;
+
+    VehicleStats stats;
+    stats.type = vehicle.getType();
+    _vehicles.push_back(stats);
+    return _vehicles.size() - 1;
+}
+
+/**
+ * @brief Adds time to the flight time of a vehicle and its company
+ * 
+ * @param vehicle Index of the vehicle
+ * @param ms Time in milliseconds to add
+ */
+void SimulationStats::addTimeInFlight(size_t vehicle, double ms) {
+    if(ms > 0) {
+        auto &stats = _vehicles[vehicle];
+        stats.timeInFlightHr += MS_TO_HR(ms);
+        _types[stats.type].timeInFlightHr += MS_TO_HR(ms);
+    }
+}
+
+/**
+ * @brief Adds to the passenger miles of a vehicle and its company
+ * 
+ * @param vehicle Index of the vehicle
+ * @param mi Passenger miles to add
+ */
+void SimulationStats::addDistanceAllPassengers(size_t vehicle, double mi) {
+    if(mi > 0) {
+        auto &stats = _vehicles[vehicle];
+        stats.distanceAllPassengersMi += mi;
+        _types[stats.type].distanceAllPassengersMi += mi;
+    }
+}
+
+/**
+ * @brief Adds time to the charging time of a vehicle and its company
+ * 
+ * @param vehicle Index of the vehicle
+ * @param ms Time in milliseconds to add
+ */
+void SimulationStats::addTimeCharging(size_t vehicle, double ms) {
+    if(ms > 0) {
+        auto &stats = _vehicles[vehicle];
+        stats.timeChargingHr += MS_TO_HR(ms);
+        _types[stats.type].timeChargingHr += MS_TO_HR(ms);
+    }
+}
+
+/**
+ * @brief Adds time to the awaiting charge time of a vehicle and its company
+ * 
+ * @param vehicle Index of the vehicle
+ * @param ms Time in milliseconds to add
+ */
+void SimulationStats::addTimeAwaitingCharge(size_t vehicle, double ms) {
+    if(ms > 0) {
+        auto &stats = _vehicles[vehicle];
+        stats.timeAwaitingChargeHr += MS_TO_HR(ms);
+        _types[stats.type].timeAwaitingChargeHr += MS_TO_HR(ms);
+    }
+}
+
+/**
+ * @brief Counts a fault against a vehicle and its company
+ * 
+ * @param vehicle Index of the vehicle
+ */
+void SimulationStats::triggerFault(size_t vehicle) {
+    auto &stats = _vehicles[vehicle];
+    stats.faultCount++;
+    _types[stats.type].faultCount++;
+}
+
+/**
+ * @brief Sets the totals of a vehicle type, e.g. from a checkpoint. The name
+ * and vehicle count stay as the vehicles were added.
+ * 
+ * @param type Type index of the vehicles
+ * @param totals Time, distance and fault totals to take
+ */
+void SimulationStats::setTypeTotals(VehicleType type, const TypeStats &totals) {
+    auto &stats = _types[type];
+    stats.timeInFlightHr = totals.timeInFlightHr;
+    stats.timeChargingHr = totals.timeChargingHr;
+    stats.timeAwaitingChargeHr = totals.timeAwaitingChargeHr;
+    stats.faultCount = totals.faultCount;
+    stats.distanceAllPassengersMi = totals.distanceAllPassengersMi;
+}
+
+/**
+ * @brief Sets the totals of one vehicle, e.g. from a checkpoint. The type
+ * stays as the vehicle was added.
+ * 
+ * @param vehicle Index of the vehicle
+ * @param totals Time, distance and fault totals to take
+ */
+void SimulationStats::setVehicleTotals(size_t vehicle, const VehicleStats &totals) {
+    auto &stats = _vehicles[vehicle];
+    stats.timeInFlightHr = totals.timeInFlightHr;
+    stats.timeChargingHr = totals.timeChargingHr;
+    stats.timeAwaitingChargeHr = totals.timeAwaitingChargeHr;
+    stats.faultCount = totals.faultCount;
+    stats.distanceAllPassengersMi = totals.distanceAllPassengersMi;
+}
+
+/**
+ * @brief Gets the totals for one company
+ * 
+ * @param type Company vehicle type, below getTypeCount()
+ * @return const TypeStats&
+ */
+const TypeStats &SimulationStats::getTypeStats(VehicleType type) const {
+    return _types[type];
+}
+
+/**
+ * @brief Gets the totals for one vehicle
+ * 
+ * @param vehicle Index of the vehicle
+ * @return const VehicleStats&
+ */
+const VehicleStats &SimulationStats::getVehicleStats(size_t vehicle) const {
+    return _vehicles[vehicle];
+}
+
+/**
+ * @brief Gets the number of vehicle types with a totals slot
+ * 
+ * @return size_t
+ */
+size_t SimulationStats::getTypeCount() const {
+    return _types.size();
+}
+
+/**
+ * @brief Gets the number of vehicles being tracked
+ * 
+ * @return size_t
+ */
+size_t SimulationStats::getVehicleCount() const {
+    return _vehicles.size();
+}
+
+/**
+ * @brief Prints the data of every company with vehicles in the fleet
+ */
+void SimulationStats::printData() const {
+    for(const auto &type : _types) {
+        if(type.vehicleCount == 0) continue;
+        std::cout << "\n" <<
+            "***" << type.name << " Vehicle Stats***\n" <<
+            "Vehicle Count:  " << type.vehicleCount << "\n" <<
+            "Time Flying:    " << type.timeInFlightHr << "\n" <<
+            "Time Charging:  " << type.timeChargingHr << "\n" <<
+            "Time Waiting:   " << type.timeAwaitingChargeHr << "\n" <<
+            "Faults:         " << type.faultCount << "\n" <<
+            "Total Distance: " << type.distanceAllPassengersMi << "\n";
+    }
+}
+
+/**
+ * @brief Prints the data of every company with vehicles in the fleet as CSV,
+ * one row per company
+ */
+void SimulationStats::printCsv() const {
+    std::cout << "company,vehicle_count,flight_hr,charging_hr,waiting_hr,faults,passenger_mi\n";
+    for(const auto &type : _types) {
+        if(type.vehicleCount == 0) continue;
+        std::cout << type.name << "," << type.vehicleCount << "," <<
+            type.timeInFlightHr << "," << type.timeChargingHr << "," <<
+            type.timeAwaitingChargeHr << "," << type.faultCount << "," <<
+            type.distanceAllPassengersMi << "\n";
+    }
+    std::cout << std::flush;
+}
@@ -0,0 +1,295 @@
+/**
+ * @file TelemetrySink.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "TelemetrySink.h"
+#include "Trace.h"
+#include <iomanip>
+#include <iostream>
+
+// Column types of the binary format
+enum class ColumnType : uint8_t {
+    F64 = 1,
+    U64 = 2,
+    U32 = 3
+};
+
+struct Column {
+    const char *name;
+    ColumnType type;
+};
+
+// Columns in file order, the state of charge buckets last
+static const Column COLUMNS[] = {
+    {"time_ms", ColumnType::F64},
+    {"flying", ColumnType::U64},
+    {"queued", ColumnType::U64},
+    {"charging", ColumnType::U64},
+    {"charger_utilization", ColumnType::F64},
+    {"passenger_mi", ColumnType::F64},
+    {"soc_0_10", ColumnType::U32},
+    {"soc_10_20", ColumnType::U32},
+    {"soc_20_30", ColumnType::U32},
+    {"soc_30_40", ColumnType::U32},
+    {"soc_40_50", ColumnType::U32},
+    {"soc_50_60", ColumnType::U32},
+    {"soc_60_70", ColumnType::U32},
+    {"soc_70_80", ColumnType::U32},
+    {"soc_80_90", ColumnType::U32},
+    {"soc_90_100", ColumnType::U32},
+};
+static_assert(sizeof(COLUMNS) / sizeof(COLUMNS[0]) == 6 + TELEMETRY_SOC_BINS, "one column per sample field");
+
+// Helper function prototypes
+template <typename T>
+static void writeColumn(std::ofstream &file, const std::vector<T> &values);
+template <typename T>
+static void writeValue(std::ofstream &file, T value);
+
+/**
+ * @brief Closes the file, writing any buffered samples
+ * 
+ */
+TelemetrySink::~TelemetrySink() {
+    close();
+}
+
+/**
+ * @brief Opens the telemetry file and starts the writer thread
+ * 
+ * @param path Path of the file, replaced if it exists
+ * @param format Columnar binary or CSV
+ * @return true if the file was opened
+ */
+bool TelemetrySink::open(const std::string &path, TelemetryFormat format) {
+    close();
+    _file.open(path, (format == TelemetryFormat::BINARY) ? std::ios::binary : std::ios::out);
+    if(!_file) {
+        std::cerr << "Unable to open telemetry file " << path << std::endl;
+        return false;
+    }
+    _format = format;
+    _closing = false;
+    _rows = 0;
+    _current = std::make_unique<Chunk>();
+    writeHeader();
+    _writer = std::thread(&TelemetrySink::writerLoop, this);
+    return true;
+}
+
+/**
+ * @brief Gets whether samples are being written
+ * 
+ * @return true if open() succeeded and close() has not been called since
+ */
+bool TelemetrySink::isOpen() const {
+    return _current != nullptr;
+}
+
+/**
+ * @brief Adds a sample to the current chunk, handing the chunk to the writer
+ * thread once it is full. Only called from the simulation thread.
+ * 
+ * @param sample Fleet metrics to record
+ */
+void TelemetrySink::record(const TelemetrySample &sample) {
+    if(!_current) return;
+    auto &chunk = *_current;
+    chunk.timeMs.push_back(sample.timeMs);
+    chunk.flying.push_back(sample.flying);
+    chunk.queued.push_back(sample.queued);
+    chunk.charging.push_back(sample.charging);
+    chunk.chargerUtilization.push_back(sample.chargerUtilization);
+    chunk.distanceAllPassengersMi.push_back(sample.distanceAllPassengersMi);
+    for(size_t bin = 0; bin < TELEMETRY_SOC_BINS; bin++) {
+        chunk.soc[bin].push_back(sample.soc[bin]);
+    }
+    _rows++;
+    if(++chunk.rows == TELEMETRY_CHUNK_ROWS) handOff();
+}
+
+/**
+ * @brief Writes the partly filled chunk, waits for the writer thread to
+ * finish and closes the file
+ * 
+ */
+void TelemetrySink::close() {
+    if(!_current) return;
+    if(_current->rows > 0) handOff();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closing = true;
+    }
+    _chunkReady.notify_one();
+    _writer.join();
+
+    _file.flush();
+    if(!_file) std::cerr << "Error writing telemetry file" << std::endl;
+    _file.close();
+    _current.reset();
+    _spare.clear();
+}
+
+/**
+ * @brief Gets the number of samples recorded since the file was opened
+ * 
+ * @return uint64_t
+ */
+uint64_t TelemetrySink::getRowCount() const {
+    return _rows;
+}
+
+/*******************Private Member Methods***********************/
+/**
+ * @brief Construct a new chunk with room for a full set of rows
+ * 
+ */
+TelemetrySink::Chunk::Chunk() {
+    timeMs.reserve(TELEMETRY_CHUNK_ROWS);
+    flying.reserve(TELEMETRY_CHUNK_ROWS);
+    queued.reserve(TELEMETRY_CHUNK_ROWS);
+    charging.reserve(TELEMETRY_CHUNK_ROWS);
+    chargerUtilization.reserve(TELEMETRY_CHUNK_ROWS);
+    distanceAllPassengersMi.reserve(TELEMETRY_CHUNK_ROWS);
+    for(auto &bin : soc) {
+        bin.reserve(TELEMETRY_CHUNK_ROWS);
+    }
+}
+
+/**
+ * @brief Empties the chunk, keeping its memory for reuse
+ * 
+ */
+void TelemetrySink::Chunk::clear() {
+    rows = 0;
+    timeMs.clear();
+    flying.clear();
+    queued.clear();
+    charging.clear();
+    chargerUtilization.clear();
+    distanceAllPassengersMi.clear();
+    for(auto &bin : soc) {
+        bin.clear();
+    }
+}
+
+/**
+ * @brief Queues the current chunk for the writer thread and carries on in a
+ * spare one. A new chunk is allocated when there is no spare, unless the
+ * writer is so far behind that memory would keep growing.
+ * 
+ */
+void TelemetrySink::handOff() {
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _chunkWritten.wait(lock, [this] { return _ready.size() < TELEMETRY_MAX_QUEUED_CHUNKS; });
+        _ready.push_back(std::move(_current));
+        if(!_spare.empty()) {
+            _current = std::move(_spare.back());
+            _spare.pop_back();
+        }
+    }
+    _chunkReady.notify_one();
+    if(!_current) _current = std::make_unique<Chunk>();
+}
+
+/**
+ * @brief Writes chunks as they are handed off until the sink is closed and
+ * every chunk is written
+ * 
+ */
+void TelemetrySink::writerLoop() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(true) {
+        _chunkReady.wait(lock, [this] { return _closing || !_ready.empty(); });
+        if(_ready.empty()) return;
+
+        auto chunk = std::move(_ready.front());
+        _ready.pop_front();
+
+        // Write without the lock so the simulation can keep handing off
+        lock.unlock();
+        {
+            TRACE_SCOPE("writeTelemetryChunk");
+            writeChunk(*chunk);
+        }
+        chunk->clear();
+        lock.lock();
+        _spare.push_back(std::move(chunk));
+        _chunkWritten.notify_one();
+    }
+}
+
+/**
+ * @brief Writes the column names and, for the binary format, their types
+ * 
+ */
+void TelemetrySink::writeHeader() {
+    if(_format == TelemetryFormat::CSV) {
+        _file << std::setprecision(15);
+        bool first = true;
+        for(const auto &column : COLUMNS) {
+            _file << (first ? "" : ",") << column.name;
+            first = false;
+        }
+        _file << "\n";
+        return;
+    }
+
+    _file.write("EVTLTLM1", 8);
+    writeValue<uint32_t>(_file, sizeof(COLUMNS) / sizeof(COLUMNS[0]));
+    for(const auto &column : COLUMNS) {
+        std::string name = column.name;
+        writeValue<uint8_t>(_file, (uint8_t)column.type);
+        writeValue<uint8_t>(_file, (uint8_t)name.size());
+        _file.write(name.data(), name.size());
+    }
+}
+
+/**
+ * @brief Writes one chunk, column by column or as CSV rows
+ * 
+ * @param chunk Chunk to write
+ */
+void TelemetrySink::writeChunk(const Chunk &chunk) {
+    if(_format == TelemetryFormat::CSV) {
+        for(size_t row = 0; row < chunk.rows; row++) {
+            _file << chunk.timeMs[row] << "," << chunk.flying[row] << "," <<
+                chunk.queued[row] << "," << chunk.charging[row] << "," <<
+                chunk.chargerUtilization[row] << "," << chunk.distanceAllPassengersMi[row];
+            for(const auto &bin : chunk.soc) {
+                _file << "," << bin[row];
+            }
+            _file << "\n";
+        }
+        return;
+    }
+
+    writeValue<uint32_t>(_file, (uint32_t)chunk.rows);
+    writeColumn(_file, chunk.timeMs);
+    writeColumn(_file, chunk.flying);
+    writeColumn(_file, chunk.queued);
+    writeColumn(_file, chunk.charging);
+    writeColumn(_file, chunk.chargerUtilization);
+    writeColumn(_file, chunk.distanceAllPassengersMi);
+    for(const auto &bin : chunk.soc) {
+        writeColumn(_file, bin);
+    }
+}
+
+/*******************Private Helper Functions***********************/
+template <typename T>
+static void writeColumn(std::ofstream &file, const std::vector<T> &values) {
+    file.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename T>
+static void writeValue(std::ofstream &file, T value) {
+    file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
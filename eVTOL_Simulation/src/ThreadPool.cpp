@@ -0,0 +1,143 @@
+/**
+ * @file ThreadPool.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "ThreadPool.h"
+
+/**
+ * @brief Construct a new Thread Pool:: Thread Pool object
+ * 
+ * @param threads Number of workers, at least one
+ */
+ThreadPool::ThreadPool(size_t threads) {
+    if(threads == 0) threads = 1;
+    for(size_t i = 0; i < threads; i++) {
+        _queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for(size_t i = 0; i < threads; i++) {
+        _workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+/**
+ * @brief Destroy the Thread Pool:: Thread Pool object
+ * 
+ * Finishes every submitted task before joining the workers.
+ */
+ThreadPool::~ThreadPool() {
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _taskReady.notify_all();
+    for(auto &worker : _workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Queues a task, spreading tasks round robin over the workers
+ * 
+ * @param task Task to run on a worker
+ */
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        // Counted under the pool lock so a worker never sees a task it
+        // can take before the task is counted
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto &queue = *_queues[_nextQueue++ % _queues.size()];
+        std::lock_guard<std::mutex> queueLock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+        _queued++;
+        _pending++;
+    }
+    _taskReady.notify_one();
+}
+
+/**
+ * @brief Blocks until every submitted task has finished
+ * 
+ */
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _allDone.wait(lock, [this] { return _pending == 0; });
+}
+
+/**
+ * @brief Gets the number of workers
+ * 
+ * @return size_t 
+ */
+size_t ThreadPool::size() const {
+    return _workers.size();
+}
+
+/*******************Private Member Methods***********************/
+/**
+ * @brief Takes a task from the worker's own queue, or steals one
+ * 
+ * @param worker Index of the worker
+ * @param task Set to the task taken
+ * @return true if a task was taken
+ */
+bool ThreadPool::popTask(size_t worker, std::function<void()> &task) {
+
+    // Newest task from our own queue first, it is the most likely to be warm
+    {
+        auto &own = *_queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if(!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Otherwise steal the oldest task from the next busy worker
+    for(size_t i = 1; i < _queues.size(); i++) {
+        auto &other = *_queues[(worker + i) % _queues.size()];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if(!other.tasks.empty()) {
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Runs tasks until the pool is destroyed
+ * 
+ * @param worker Index of the worker
+ */
+void ThreadPool::workerLoop(size_t worker) {
+    std::function<void()> task;
+    while(true) {
+        if(popTask(worker, task)) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _queued--;
+            }
+            task();
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(--_pending == 0) _allDone.notify_all();
+            continue;
+        }
+
+        // Sleep until a task is queued; a task counted but already taken by
+        // another worker just sends us around the loop again
+        std::unique_lock<std::mutex> lock(_mutex);
+        _taskReady.wait(lock, [this] { return _stop || _queued > 0; });
+        if(_stop && _queued == 0) return;
+    }
+}
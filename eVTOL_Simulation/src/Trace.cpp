@@ -0,0 +1,195 @@
+/**
+ * @file Trace.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "Trace.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+// Heap allocations made by the current thread, counted in traced builds
+static thread_local uint64_t threadAllocations = 0;
+
+// Time every trace timestamp is measured from
+static const auto traceEpoch = std::chrono::steady_clock::now();
+
+/**
+ * @brief Gets the tracer shared by every thread
+ * 
+ * @return Tracer&
+ */
+Tracer &Tracer::get() {
+    static Tracer tracer;
+    return tracer;
+}
+
+/**
+ * @brief Gets the time since the program started
+ * 
+ * @return uint64_t Time in nanoseconds
+ */
+uint64_t Tracer::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - traceEpoch).count();
+}
+
+/**
+ * @brief Records a timed scope on the calling thread
+ * 
+ * @param name Name of the scope, a string literal
+ * @param startNs Time the scope was entered
+ * @param endNs Time the scope was left
+ */
+void Tracer::addScope(const char *name, uint64_t startNs, uint64_t endNs) {
+    append(Event{name, startNs, endNs - startNs, 0.0, false});
+}
+
+/**
+ * @brief Records the value of a counter on the calling thread
+ * 
+ * @param name Name of the counter, a string literal
+ * @param value Value of the counter now
+ */
+void Tracer::addCounter(const char *name, double value) {
+    append(Event{name, now(), 0, value, true});
+}
+
+/**
+ * @brief Writes the events of every thread as Chrome trace JSON. Call once
+ * the traced threads are idle.
+ * 
+ * @param path Path of the JSON file
+ * @return true if the file was written
+ */
+bool Tracer::writeChromeJson(const std::string &path) {
+    std::ofstream file(path);
+    if(!file) {
+        std::cerr << "Unable to open trace file " << path << std::endl;
+        return false;
+    }
+
+    // Chrome trace times are in microseconds
+    std::lock_guard<std::mutex> lock(_mutex);
+    file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[\n";
+    bool first = true;
+    for(const auto &buffer : _buffers) {
+        for(const auto &event : buffer->events) {
+            file << (first ? "" : ",\n") << "{\"name\":\"" << event.name << "\",\"pid\":1,\"tid\":" <<
+                buffer->tid << ",\"ts\":" << event.startNs / 1000.0;
+            if(event.counter) {
+                file << ",\"ph\":\"C\",\"args\":{\"value\":" << event.value << "}}";
+            } else {
+                file << ",\"ph\":\"X\",\"dur\":" << event.durationNs / 1000.0 << "}";
+            }
+            first = false;
+        }
+        if(buffer->dropped) {
+            std::cerr << "Trace buffer of thread " << buffer->tid << " dropped " << buffer->dropped << " events" << std::endl;
+        }
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return (bool)file;
+}
+
+/*******************Private Member Methods***********************/
+/**
+ * @brief Gets the buffer of the calling thread, creating it on first use.
+ * The tracer owns the buffers so they outlive the threads.
+ * 
+ * @return ThreadBuffer&
+ */
+Tracer::ThreadBuffer &Tracer::getThreadBuffer() {
+    static thread_local ThreadBuffer *buffer = nullptr;
+    if(buffer == nullptr) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _buffers.push_back(std::make_unique<ThreadBuffer>());
+        buffer = _buffers.back().get();
+        buffer->tid = _buffers.size();
+    }
+    return *buffer;
+}
+
+/**
+ * @brief Adds an event to the calling thread's buffer
+ * 
+ * @param event Event to add
+ */
+void Tracer::append(const Event &event) {
+    auto &buffer = getThreadBuffer();
+    if(buffer.events.size() >= TRACE_MAX_EVENTS_PER_THREAD) {
+        buffer.dropped++;
+        return;
+    }
+    buffer.events.push_back(event);
+}
+
+/*******************Trace Scope***********************/
+/**
+ * @brief Starts timing a scope
+ * 
+ * @param name Name of the scope, a string literal
+ */
+TraceScope::TraceScope(const char *name)
+    : _name{name}
+    , _startNs{Tracer::now()} {}
+
+/**
+ * @brief Records the scope as it ends
+ * 
+ */
+TraceScope::~TraceScope() {
+    Tracer::get().addScope(_name, _startNs, Tracer::now());
+}
+
+/*******************Allocation Counting***********************/
+/**
+ * @brief Gets the number of heap allocations made by the calling thread,
+ * always 0 unless built with TRACE_MODE
+ * 
+ * @return uint64_t
+ */
+uint64_t getThreadAllocations() {
+    return threadAllocations;
+}
+
+#if TRACE_MODE
+// Replace the global allocator so traced builds can count allocations
+void *operator new(size_t size) {
+    threadAllocations++;
+    if(void *memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+    std::free(memory);
+}
+
+// Over-aligned types, e.g. the cache line aligned stats, allocate here
+void *operator new(size_t size, std::align_val_t align) {
+    threadAllocations++;
+    size_t alignment = (size_t)align;
+    size_t rounded = (size + alignment - 1) / alignment * alignment;
+    if(void *memory = std::aligned_alloc(alignment, rounded ? rounded : alignment)) return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+#endif /* TRACE_MODE */
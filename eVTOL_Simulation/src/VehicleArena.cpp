@@ -0,0 +1,52 @@
+/**
+ * @file VehicleArena.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "VehicleArena.h"
+
+/**
+ * @brief Construct a new Vehicle Arena:: Vehicle Arena object
+ * 
+ * @param capacity Number of vehicles the arena holds
+ */
+VehicleArena::VehicleArena(size_t capacity) {
+    _vehicles.reserve(capacity);
+}
+
+/**
+ * @brief Places a new vehicle in the arena
+ * 
+ * @param spec Spec of the vehicle type, must outlive the arena
+ * @return Vehicle* Null if the arena is full
+ */
+Vehicle *VehicleArena::create(const VehicleSpec &spec) {
+
+    // Never grow, that would move the vehicles already handed out
+    if(_vehicles.size() == _vehicles.capacity()) return nullptr;
+    _vehicles.emplace_back(spec);
+    return &_vehicles.back();
+}
+
+/**
+ * @brief Gets the number of vehicles placed in the arena
+ * 
+ * @return size_t 
+ */
+size_t VehicleArena::size() const {
+    return _vehicles.size();
+}
+
+/**
+ * @brief Gets the number of vehicles the arena holds
+ * 
+ * @return size_t 
+ */
+size_t VehicleArena::capacity() const {
+    return _vehicles.capacity();
+}
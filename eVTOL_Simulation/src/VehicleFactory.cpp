@@ -1,48 +1,114 @@
-/**
- * @file VehicleFactory.cpp
- * @author Adrian Deardorff (80deardorff@gmail.com)
- * @version 0.1
- * @date 2022-05-11
- * 
- * @copyright Copyright (c) 2022
- * 
- */
-#include "VehicleFactory.h"
-#include "Alpha.h"
-#include "Beta.h"
-#include "Charlie.h"
-#include "Delta.h"
-#include "Echo.h"
-
-/**
- * @brief Creates a smart pointer for Vehicle object
- * 
- * @param vehicle
- * @return std::shared_ptr<Vehicle>
- */
-std::shared_ptr<Vehicle> VehicleFactory::createVehicle(VehicleType vehicleType) const {
-
-    std::shared_ptr<Vehicle> newVehicle;
-
-    switch (vehicleType) {
-        case VehicleType::ALPHA_TYPE:
-            newVehicle = std::make_shared<Alpha>();
-            break;
-        case VehicleType::BETA_TYPE:
-            newVehicle = std::make_shared<Beta>();
-            break;
-        case VehicleType::CHARLIE_TYPE:
-            newVehicle = std::make_shared<Charlie>();
-            break;
-        case VehicleType::DELTA_TYPE:
-            newVehicle = std::make_shared<Delta>();
-            break;
-        case VehicleType::ECHO_TYPE:
-            newVehicle = std::make_shared<Echo>();
-            break;
-        default:
-        break;
-    }
-
-    return newVehicle;
-}
\ No newline at end of file
+/**
+ * @file VehicleFactory.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2022-05-11
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+#include "VehicleFactory.h"
+#include <algorithm>
+#include <iostream>
+
+// Vehicles per chunk when a fleet is built in parallel, each chunk placed
+// in its own arena
+constexpr size_t FLEET_CHUNK_SIZE = 16384;
+
+/**
+ * @brief Construct a new Vehicle Factory:: Vehicle Factory object
+ * 
+ * @param registry Specs of every vehicle type, must outlive the vehicles
+ */
+VehicleFactory::VehicleFactory(const VehicleRegistry &registry)
+    : _registry{registry} {}
+
+/**
+ * @brief Creates a smart pointer for Vehicle object
+ * 
+ * @param vehicleType Index of the vehicle spec in the registry
+ * @return std::shared_ptr<Vehicle> Null if the type is not registered
+ */
+std::shared_ptr<Vehicle> VehicleFactory::createVehicle(VehicleType vehicleType) const {
+
+    if(vehicleType >= _registry.size()) return nullptr;
+    return std::make_shared<Vehicle>(_registry[vehicleType]);
+}
+
+/**
+ * @brief Creates a fleet with at least one of every vehicle type in the mix
+ * and the rest drawn from the mix.
+ * 
+ * The type of vehicle i is drawn from Philox block i / 4 of the stream, so the
+ * fleet is a pure function of the seed and can be built in chunks on any
+ * number of threads. Every chunk is placed in its own arena and its vehicle
+ * pointers share the arena's control block, so a chunk costs two
+ * allocations however many vehicles it holds, the arena with its control
+ * block and the arena's vehicle block, and is freed at once with the last
+ * of its pointers.
+ * 
+ * @param mix Share of each vehicle type
+ * @param count Number of vehicles in the fleet
+ * @param seed Seed of the run
+ * @param stream Random stream under the seed, FLEET_STREAM by default
+ * @param pool Threads to build the chunks on, or nullptr for this thread
+ * @return std::vector<std::shared_ptr<Vehicle>> Empty if the mix has no
+ * registered type with a share
+ */
+std::vector<std::shared_ptr<Vehicle>> VehicleFactory::createFleet(const FleetMix &mix, size_t count, uint64_t seed, uint64_t stream, ThreadPool *pool) const {
+
+    // Running total of the shares, and the types every fleet gets one of
+    std::vector<double> cumulative(_registry.size());
+    std::vector<VehicleType> required;
+    double total = 0.0;
+    for(VehicleType type = 0; type < _registry.size(); type++) {
+        double share = mix.empty() ? 1.0 : (type < mix.size() ? std::max(mix[type], 0.0) : 0.0);
+        if(share > 0.0) required.push_back(type);
+        total += share;
+        cumulative[type] = total;
+    }
+    if(required.empty()) {
+        std::cerr << "Fleet mix gives no vehicle type a share" << std::endl;
+        return {};
+    }
+
+    count = std::max(count, required.size());
+    std::vector<std::shared_ptr<Vehicle>> fleet(count);
+    Philox rng(seed, stream);
+
+    auto buildChunk = [&](size_t begin, size_t end) {
+        auto arena = std::make_shared<VehicleArena>(end - begin);
+        Philox::Block block = rng.block(begin / 4);
+        for(size_t i = begin; i < end; i++) {
+            VehicleType type;
+            if(i < required.size()) {
+                type = required[i];
+            } else {
+                // Each block feeds four vehicles, 32 bits is plenty to pick
+                // a type. A type without a share has no width in the running
+                // total, so the first total above the draw is a drawn type.
+                if(i % 4 == 0) block = rng.block(i / 4);
+                double draw = block[i % 4] * (1.0 / 4294967296.0) * total;
+                // Count the totals at or below the draw without branching,
+                // random draws defeat the branch predictor in a search
+                type = 0;
+                for(auto bound : cumulative) type += (bound <= draw);
+                if(type >= cumulative.size()) type = required.back();
+            }
+            fleet[i] = std::shared_ptr<Vehicle>(arena, arena->create(_registry[type]));
+        }
+    };
+
+    size_t chunks = (count + FLEET_CHUNK_SIZE - 1) / FLEET_CHUNK_SIZE;
+    if(pool == nullptr || chunks <= 1) {
+        buildChunk(0, count);
+        return fleet;
+    }
+    for(size_t c = 0; c < chunks; c++) {
+        pool->submit([&buildChunk, c, count] {
+            buildChunk(c * FLEET_CHUNK_SIZE, std::min(count, (c + 1) * FLEET_CHUNK_SIZE));
+        });
+    }
+    pool->wait();
+    return fleet;
+}
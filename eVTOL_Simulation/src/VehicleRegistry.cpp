@@ -0,0 +1,177 @@
+/**
+ * @file VehicleRegistry.cpp
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+#include "main.h"
+#include "VehicleRegistry.h"
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// Number of columns in a row of the vehicle config file, the last optional
+constexpr size_t NUM_OF_SPEC_FIELDS = 8;
+
+// Helper function prototypes
+static bool parseDouble(const std::string &field, double &value);
+static bool parseInt(const std::string &field, int &value);
+static bool parseSpec(const std::vector<std::string> &fields, VehicleSpec &spec);
+static std::vector<std::string> splitRow(const std::string &line);
+
+/**
+ * @brief Loads vehicle specs from a CSV file
+ * 
+ * The first row that is not blank or a # comment is the header and is
+ * skipped. Every following row is one vehicle type, in the column order
+ * name, cruise speed (mph), battery capacity (kWh), time to charge (hr),
+ * energy use (kWh/mi), passenger count, fault probability (per hr) and
+ * optionally the state of charge (%) the charge rate starts to taper at.
+ * 
+ * @param path Path of the config file
+ * @return true if every row was loaded
+ */
+bool VehicleRegistry::loadCsv(const std::string &path) {
+    std::ifstream file(path);
+    if(!file) {
+        std::cerr << "Unable to open vehicle config " << path << std::endl;
+        return false;
+    }
+
+    std::string line;
+    size_t lineNum = 0;
+    bool header = true;
+    while(std::getline(file, line)) {
+        lineNum++;
+
+        // Tolerate files saved with Windows line endings
+        if(!line.empty() && line.back() == '\r') line.pop_back();
+        if(line.empty() || line[0] == '#') continue;
+        if(header) {
+            header = false;
+            continue;
+        }
+
+        VehicleSpec spec;
+        if(!parseSpec(splitRow(line), spec)) {
+            std::cerr << path << ":" << lineNum << ": invalid vehicle spec" << std::endl;
+            return false;
+        }
+        addSpec(spec);
+    }
+
+    if(_specs.empty()) {
+        std::cerr << path << ": no vehicle specs found" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Adds a spec to the table and fills in its derived values
+ * 
+ * @param spec Spec with the config file values set
+ * @return VehicleType Type index of the new spec
+ */
+VehicleType VehicleRegistry::addSpec(VehicleSpec spec) {
+
+    // Number of checks per hour in real time (1 min in simulation)
+    int numChecks = HR_TO_MS(1) / SIM_DELAY;
+
+    spec.type = _specs.size();
+
+    // Convert to energy used per millisecond of cruise
+    spec.energyUseKwh = spec.energyUsePerMiKwh * spec.cruiseSpeedMph / HR_TO_MS(1);
+
+    // The original model faulted with probability 1 - p^(1/numChecks) on
+    // every loop iteration; -ln(1 - probPerIteration) spread across one
+    // iteration is the exponential rate with the same statistics
+    spec.faultRate = -log(spec.faultProbability) / numChecks / SIM_STEP_MS;
+
+    // Time to charge is at the rated rate; a tapering charger slows above
+    // the taper point, so it is tabulated once here for every vehicle
+    spec.fullChargeMs = HR_TO_MS(spec.timeToChargeHr);
+    if(spec.chargeTaperSoc < 100.0) {
+        double ratedKwhPerMs = (double)spec.batteryCapacityKwh / HR_TO_MS(spec.timeToChargeHr);
+        spec.chargeCurve = ChargeCurve::createCcCv(spec.batteryCapacityKwh, ratedKwhPerMs, spec.chargeTaperSoc / 100.0);
+        spec.fullChargeMs = spec.chargeCurve->getFullMs();
+    }
+
+    _specs.push_back(spec);
+    return spec.type;
+}
+
+/**
+ * @brief Gets the number of vehicle types
+ * 
+ * @return size_t
+ */
+size_t VehicleRegistry::size() const {
+    return _specs.size();
+}
+
+/**
+ * @brief Gets the spec of a vehicle type
+ * 
+ * @param type Type index of the spec
+ * @return const VehicleSpec&
+ */
+const VehicleSpec &VehicleRegistry::operator[](VehicleType type) const {
+    return _specs[type];
+}
+
+/*******************Private Helper Functions***********************/
+static bool parseDouble(const std::string &field, double &value) {
+    char *end = nullptr;
+    value = std::strtod(field.c_str(), &end);
+    return !field.empty() && *end == '\0';
+}
+
+static bool parseInt(const std::string &field, int &value) {
+    char *end = nullptr;
+    value = (int)std::strtol(field.c_str(), &end, 10);
+    return !field.empty() && *end == '\0';
+}
+
+static bool parseSpec(const std::vector<std::string> &fields, VehicleSpec &spec) {
+    if(fields.size() < NUM_OF_SPEC_FIELDS - 1 || fields.size() > NUM_OF_SPEC_FIELDS || fields[0].empty()) return false;
+
+    spec.name = fields[0];
+    bool valid = parseInt(fields[1], spec.cruiseSpeedMph)
+        && parseInt(fields[2], spec.batteryCapacityKwh)
+        && parseDouble(fields[3], spec.timeToChargeHr)
+        && parseDouble(fields[4], spec.energyUsePerMiKwh)
+        && parseInt(fields[5], spec.passengerCount)
+        && parseDouble(fields[6], spec.faultProbability)
+        && (fields.size() < NUM_OF_SPEC_FIELDS || parseDouble(fields[7], spec.chargeTaperSoc));
+
+    // Rates are divided by these, so they have to be positive
+    return valid
+        && spec.cruiseSpeedMph > 0
+        && spec.batteryCapacityKwh > 0
+        && spec.timeToChargeHr > 0.0
+        && spec.energyUsePerMiKwh > 0.0
+        && spec.passengerCount >= 0
+        && spec.faultProbability > 0.0 && spec.faultProbability <= 1.0
+        && spec.chargeTaperSoc > 0.0 && spec.chargeTaperSoc <= 100.0;
+}
+
+static std::vector<std::string> splitRow(const std::string &line) {
+    std::vector<std::string> fields;
+    std::istringstream row(line);
+    std::string field;
+    while(std::getline(row, field, ',')) {
+
+        // Trim the spaces around each value
+        auto first = field.find_first_not_of(" \t");
+        auto last = field.find_last_not_of(" \t");
+        fields.push_back(first == std::string::npos ? "" : field.substr(first, last - first + 1));
+    }
+    return fields;
+}
@@ -1,84 +1,188 @@
-/**
- * @file main.cpp
- * @brief The following program runs the eVTOL simulation
- * @author Adrian Deardorff (80deardorff@gmail.com)
- * @version 0.1
- * @date 2022-05-11
- * 
- * @copyright Copyright (c) 2022
- * 
- */
-
-#include "main.h"
-#include <iostream>
-#include <vector>
-#include <memory>
-#include <random>
-#include <thread>
-#include "Vehicle.h"
-#include "VehicleFactory.h"
-#include "Simulation.h"
-#include "Charger.h"
-#include "Alpha.h"
-#include "Beta.h"
-#include "Charlie.h"
-#include "Delta.h"
-#include "Echo.h"
-
-int main(void) {
-
-    // Create a simulation instance
-    Simulation sim;
-    
-    // Create vehicle factory instance
-    VehicleFactory factory;
-
-    // Create vector that holds all vehicles instance addresses
-    std::vector<std::shared_ptr<Vehicle>> vehiclesFlying;
-
-    // Cast strongly typed enum for readability
-    auto numOfVehicleTypes = (size_t)VehicleType::NUM_OF_VEHICLE_TYPES;
-
-    // Push at least one of every vehicle type to the vector
-    for (size_t i = 0; i < numOfVehicleTypes; i++) {
-        vehiclesFlying.push_back(factory.createVehicle((VehicleType)i));
-    }
-
-    // Randomly choose vehicles to create and push to vector up to max vehicles
-    // number of vehicles for the test
-    std::mt19937 mt((unsigned) time(nullptr));
-    for (size_t i = numOfVehicleTypes; i < NUM_OF_TEST_VEHICLES; i++) {
-        // Get a random number between 0(inc) and number(exc) of enum types
-        int random = mt() % numOfVehicleTypes;
-        vehiclesFlying.push_back(factory.createVehicle((VehicleType)random));
-    }
-
-    // Create vector that holds all charger instance addresses
-    std::vector<std::unique_ptr<Charger>> chargers;
-
-    // Create chargers and push to vector
-    for (size_t i = 0; i < NUM_OF_CHARGERS; i++) {
-        chargers.push_back(std::make_unique<Charger>());
-    }
-
-    // Start the simulation
-    sim.startSimulation(vehiclesFlying, chargers, TEST_LENGTH_MS);
-
-    // Print all data from each vehicle company to the terminal
-    std::cout << "Test Results for " << TEST_LENGTH_MIN <<
-    " MIN\n(" << TEST_LENGTH_MIN << " HR of Real Time)" << 
-    std::endl;
-
-    std::cout << "\n";
-    Alpha::printData();
-    std::cout << "\n";
-    Beta::printData();
-    std::cout << "\n";
-    Charlie::printData();
-    std::cout << "\n";
-    Delta::printData();
-    std::cout << "\n";
-    Echo::printData();
-
-    return 0;
-}
+/**
+ * @file main.cpp
+ * @brief The following program runs the eVTOL simulation
+ * @author Adrian Deardorff (80deardorff@gmail.com)
+ * @version 0.1
+ * @date 2022-05-11
+ * 
+ * @copyright Copyright (c) 2022
+ * 
+ */
+
+#include "main.h"
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "Vehicle.h"
+#include "VehicleFactory.h"
+#include "VehicleRegistry.h"
+#include "Simulation.h"
+#include "SimClock.h"
+#include "DepotNetwork.h"
+#include "BatchRunner.h"
+#include "SimulationConfig.h"
+#include "ThreadPool.h"
+#include "ProductionFleet.h"
+#include "TelemetrySink.h"
+#include "Trace.h"
+#include "Checkpoint.h"
+
+int main(int argc, char **argv) {
+
+    // Start from the defaults in main.h and apply the command line
+    SimulationConfig config;
+    bool exit;
+    if(!config.parseArgs(argc, argv, exit)) {
+        std::cerr << "Run with --help for the list of settings" << std::endl;
+        return 1;
+    }
+    if(exit) return 0;
+#if !TRACE_MODE
+    if(!config.traceFile.empty()) {
+        std::cerr << "Built without TRACE_MODE, no trace is written" << std::endl;
+    }
+#endif /* TRACE_MODE */
+
+    // Load the spec of every company vehicle type
+    VehicleRegistry registry;
+    if(!registry.loadCsv(config.vehicleFile)) {
+        return 1;
+    }
+
+    // The fixed kernels only know the types they were compiled for
+    if(config.fixedKernels && !ProductionKernels::matches(registry)) {
+        std::cerr << config.vehicleFile << " does not match the vehicle types in ProductionFleet.h" << std::endl;
+        return 1;
+    }
+
+    // One seed reproduces both the fleet mix and the faults of a run
+    auto seed = config.hasSeed ? config.seed : (uint64_t) time(nullptr);
+
+    if(config.replicas) {
+        if(!config.telemetryFile.empty()) {
+            std::cerr << "Telemetry is only written for single runs" << std::endl;
+        }
+        if(!config.checkpointFile.empty() || !config.restoreFile.empty()) {
+            std::cerr << "Checkpoints are only taken of single runs" << std::endl;
+        }
+
+        // Run many independent replicas across all cores and summarize them
+        BatchRunner batch(registry, config);
+        batch.run(config.replicas, seed);
+        if(config.output == OutputFormat::CSV) {
+            batch.printSummaryCsv();
+        } else {
+            batch.printSummary();
+        }
+        if(TRACE_MODE && !config.traceFile.empty()) {
+            Tracer::get().writeChromeJson(config.traceFile);
+        }
+        return 0;
+    }
+
+    // Only the event-driven engine keeps its whole state between events
+    bool restoring = !config.restoreFile.empty();
+    if(!config.eventDriven && (restoring || !config.checkpointFile.empty())) {
+        std::cerr << "Checkpoints need the event engine" << std::endl;
+        return 1;
+    }
+    Checkpoint checkpoint;
+    if(restoring && !checkpoint.read(config.restoreFile)) {
+        return 1;
+    }
+
+    // The fleet, depots and fault stream of a restored run are the
+    // checkpoint's
+    if(restoring) {
+        for(const char *key : {"vehicles", "mix", "depots", "chargers", "policy", "seed"}) {
+            if(config.given.count(key)) {
+                std::cerr << "--" << key << " is ignored, restored runs take it from the checkpoint" << std::endl;
+            }
+        }
+    }
+
+    // Create the clock that paces the simulation
+    auto clock = SimClock::create(config.clockMode, config.timeScale);
+
+    // Create a simulation instance
+    Simulation sim(*clock, registry, seed);
+    sim.setStepMs(config.stepMs);
+    ProductionKernels fixedKernels;
+    if(config.fixedKernels) sim.setKernels(&fixedKernels);
+
+    // Stream fleet metrics from a writer thread while the run goes on
+    TelemetrySink telemetry;
+    if(!config.telemetryFile.empty()) {
+        if(!telemetry.open(config.telemetryFile, config.telemetryFormat)) return 1;
+        sim.setTelemetry(&telemetry, config.telemetryMs);
+    }
+    sim.setShowProgress(config.showProgress && config.output == OutputFormat::TEXT);
+    
+    // Create vehicle factory instance
+    VehicleFactory factory(registry);
+
+    std::vector<std::shared_ptr<Vehicle>> vehiclesFlying;
+    std::unique_ptr<DepotNetwork> depots;
+    if(restoring) {
+
+        // Rebuild the checkpointed fleet and depots; the checkpoint fills in
+        // their state
+        for(const auto &entry : checkpoint.vehicles) {
+            if(entry.type >= registry.size()) {
+                std::cerr << config.restoreFile << " has vehicle types not in " << config.vehicleFile << std::endl;
+                return 1;
+            }
+            vehiclesFlying.push_back(factory.createVehicle(entry.type));
+        }
+        size_t chargers = checkpoint.depots.empty() ? 0 : checkpoint.depots[0].chargerCount;
+        auto policy = checkpoint.depots.empty() ? config.policy : (QueuePolicy)checkpoint.depots[0].policy;
+        depots = std::make_unique<DepotNetwork>(checkpoint.depots.size(), chargers, policy, config.orderedArrivals);
+    } else {
+
+        // Create the fleet, at least one of every vehicle type in the mix and
+        // the rest drawn from the mix up to the number of vehicles for the test
+        vehiclesFlying = factory.createFleet(config.mix, config.vehicles, seed);
+        if(vehiclesFlying.empty()) return 1;
+
+        // Create the depots, each with its own chargers and queue waiting for them
+        depots = std::make_unique<DepotNetwork>(config.depots, config.chargers, config.policy, config.orderedArrivals);
+    }
+    if(!config.checkpointFile.empty()) {
+        double checkpointMs = (config.checkpointHours > 0.0) ? HR_TO_MS(config.checkpointHours) : config.getLengthMs();
+        sim.setCheckpoint(config.checkpointFile, checkpointMs);
+    }
+
+    // Start the simulation
+    if(restoring) {
+        if(!sim.resumeEventSimulation(checkpoint, vehiclesFlying, *depots, config.getLengthMs())) return 1;
+    } else if(config.eventDriven) {
+        sim.startEventSimulation(vehiclesFlying, *depots, config.getLengthMs());
+    } else {
+        // Step large fleets in chunks across the cores
+        std::unique_ptr<ThreadPool> stepPool;
+        if(config.stepThreads != 1) {
+            stepPool = std::make_unique<ThreadPool>(config.stepThreads ? config.stepThreads : std::thread::hardware_concurrency());
+            sim.setStepPool(stepPool.get());
+        }
+        sim.startSimulation(vehiclesFlying, *depots, config.getLengthMs());
+    }
+    telemetry.close();
+    if(TRACE_MODE && !config.traceFile.empty()) {
+        Tracer::get().writeChromeJson(config.traceFile);
+    }
+
+    // Print all data from each vehicle company to the terminal
+    if(config.output == OutputFormat::CSV) {
+        sim.getStats().printCsv();
+        return 0;
+    }
+
+    std::cout << "Test Results for " << config.hours * 60.0 / config.timeScale <<
+    " MIN\n(" << config.hours << " HR of Real Time)" << 
+    std::endl;
+
+    sim.getStats().printData();
+    sim.printPacingStats();
+
+    return 0;
+}